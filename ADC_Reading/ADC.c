@@ -9,54 +9,657 @@
  * Revisions:
  *   May 10,  2017 - Initial Creation
  *   May 12, 2017 - Cleaned and commented
+ *   Oct 19, 2026 - Timer triggered continuous mode with DMA blocks
+ *   Oct 19, 2026 - Multi-channel sequence mode, input pin table
+ *   Oct 19, 2026 - volts_ADC for decimated values
+ *   Oct 19, 2026 - Float constant replaced by Q16 gain/offset from Calibration
+ *   Oct 19, 2026 - Per sample handler mode
+ *   Oct 19, 2026 - raw_ADC, inverse of mV_ADC
+ *   Oct 19, 2026 - Window comparator monitor mode
+ *   Oct 19, 2026 - Sample queue replaces ADCValue/newValue, no lost or repeated reads
+ *   Oct 19, 2026 - Linked mode, DMA block setup shared through start_Blocks
+ *   Oct 19, 2026 - Profile probe in DMA block ISR
+ *   Oct 19, 2026 - Trace marks on ISRs, ADC14 ISR has one exit
  *
  *  Author: Drew Hartley, Jordan Jones
  */
 #include "ADC.h"
+#include "Cycles.h"
+#include "Profile.h"
+#include "Trace.h"
 
-#define CALIBRATION_VALUE .000201
-static unsigned int ADCValue;
-static int newValue;
+//Single mode results, positions are free running and masked like Ring_Buffer
+static ADCSample SAMPLE_QUEUE[ ADC_SAMPLES ];
+static volatile unsigned int sampleHead;                    // ISR only
+static volatile unsigned int sampleTail;                    // App only
+static unsigned int sampleSequence;                         // ISR only
+static volatile unsigned int samplesLost;
+static unsigned int lastValue;                              // Returned when queue is empty
+
+//Continuous mode blocks, positions are free running and masked like Ring_Buffer
+static unsigned short BLOCK_DATA[ ADC_BLOCKS ][ ADC_BLOCK_SIZE ];
+static unsigned short SCRATCH_DATA[ ADC_BLOCK_SIZE ];      // Target when app holds every block
+static unsigned int blockSequence[ ADC_BLOCKS ];
+static volatile unsigned int blockHead;                     // Next position to complete, ISR only
+static volatile unsigned int blockTail;                     // Oldest position held by app
+static unsigned int blockArm;                               // Next position to give DMA
+static unsigned int armedPosition[2];                       // Per structure, position being filled
+static int armedScratch[2];                                 // Per structure, set if filling scratch
+static int nextDone;                                        // Structure that completes next
+static unsigned int sequence;
+static volatile unsigned int overruns;
+static unsigned int blockChannels = 1;                      // Channels stored in each block
+
+//Sequence mode state, ADC ISR fills blocks directly
+static unsigned int seqChannels;                            // 0 when not in sequence mode
+static unsigned int seqPerChannel;                          // Sequences per block
+static unsigned int seqIndex;                               // Sequences stored in current block
+static unsigned short * seqTarget;
+static unsigned int seqPosition;
+static int seqScratch;
+
+//Sample mode
+static SampleHandler sampleHandler;                         // 0 when not in sample mode
+
+//Monitor mode, events queued like Ring_Buffer
+#define WINDOW_FLAGS (ADC14_IER1_HIIE | ADC14_IER1_LOIE | ADC14_IER1_INIE)
+static int monitoring;
+static ADCEvent events[ ADC_EVENTS ];
+static volatile unsigned int eventHead;                     // ISR only
+static volatile unsigned int eventTail;                     // App only
+static volatile unsigned int eventsMissed;
+
+//Analog input pins A0-A23, high nibble port, low nibble bit
+static const unsigned char INPUT_PINS[ ADC_INPUTS ] = {
+    0x55, 0x54, 0x53, 0x52, 0x51, 0x50,                     // A0-A5   P5.5-P5.0
+    0x47, 0x46, 0x45, 0x44, 0x43, 0x42, 0x41, 0x40,         // A6-A13  P4.7-P4.0
+    0x61, 0x60,                                             // A14-A15 P6.1-P6.0
+    0x91, 0x90,                                             // A16-A17 P9.1-P9.0
+    0x87, 0x86, 0x85, 0x84, 0x83, 0x82                      // A18-A23 P8.7-P8.2
+};
+
+static int  start_Single(unsigned int input, unsigned int rate);
+static void start_Blocks(unsigned int input, unsigned int trigger);
+static void arm_Block(int alternate);
+static int  next_Block(unsigned short ** target, unsigned int * position);
+static void publish_Block(int scratch, unsigned int position);
+static void start_Trigger(unsigned int rate);
+static void select_Input(unsigned int input);
+static void window_Event(void);
 
 void init_ADC(void){
     NVIC->ISER[0] = 1 << ((ADC14_IRQn) & 31);         // Enable ADC interrupt in NVIC module
+    ADC14->CTL0 &= ~ADC14_CTL0_ENC;                   // Settings only change while disabled
     ADC14->CTL0  = 0;      // Ensure it is off and all settings cleared
     ADC14->CTL0  = ADC14_CTL0_SHT0_2  | ADC14_CTL0_SHP |
                    ADC14_CTL0_PDIV__4 | ADC14_CTL0_MSC |
                    ADC14_CTL0_ON;
 
-    ADC14->CTL1 = ADC14_CTL1_RES__14BIT;      // Use sampling timer, 12-bit conversion results
-    ADC14->MCTL[0] |= ADC14_MCTLN_INCH_1;     // A2 ADC input in single mode select; Vref=AVCC
-    ADC14->IER0 |= ADC14_IER0_IE0;            // Enable ADC conv complete interrupt
+    ADC14->CTL1 = ADC14_CTL1_RES__14BIT;      // Use sampling timer, 14-bit conversion results
+    ADC14->MCTL[0] = ADC_DEFAULT_INPUT;       // A1 ADC input in single mode select; Vref=AVCC
+    ADC14->IER0 = ADC14_IER0_IE0;             // Enable ADC conv complete interrupt
+    ADC14->IER1 = 0;                          // No window or overflow interrupts
     ADC14->CTL0 |= ADC14_CTL0_ENC;            // Enable ADC with current configuration
-    P5->SEL1 |= BIT4;                         // Configure P5.4 for ADC
-    P5->SEL0 |= BIT4;
+    select_Input(ADC_DEFAULT_INPUT);          // Configure P5.4 for ADC
+    seqChannels   = 0;
+    blockChannels = 1;
+    sampleHandler = 0;
+    monitoring    = 0;
+    sampleTail    = sampleHead;                             // Results from before are stale
+    init_Cycles();
 }
 
 void ADC14_IRQHandler(void){
-    ADCValue = ADC14->MEM[0];                   // Store new data to buffer
-    newValue = 1;                               // Set flag
+    unsigned int channel;
+    TRACE_ENTER(TRACE_ADC14);
+    if(monitoring){
+        window_Event();
+    }else if(sampleHandler){
+        if(ADC14->IFGR1 & ADC14_IFGR1_OVIFG){               // Last result was overwritten
+            ADC14->CLRIFGR1 = ADC14_CLRIFGR1_CLROVIFG;
+            overruns++;
+        }
+        sampleHandler(ADC14->MEM[0]);                       // Reading clears IFG0
+    }else if(0 == seqChannels){
+        unsigned int value = ADC14->MEM[0];     // Reading clears flag
+        if(sampleHead - sampleTail >= ADC_SAMPLES){
+            samplesLost++;                      // Sequence still counts it
+        }else{
+            ADCSample * slot = &SAMPLE_QUEUE[ sampleHead & (ADC_SAMPLES - 1) ];
+            slot->value     = value;
+            slot->sequence  = sampleSequence;
+            slot->timestamp = get_Cycles();
+            sampleHead++;                       // Publish after slot is written
+        }
+        sampleSequence++;
+    }else{
+        //Sequence done, store each channel in its own part of the block
+        for(channel = 0; channel < seqChannels; channel++){
+            seqTarget[channel*seqPerChannel + seqIndex] = ADC14->MEM[channel];
+        }
+        ADC14->CTL0 &= ~ADC14_CTL0_ENC;         // Single sequence mode needs ENC toggled
+        ADC14->CTL0 |=  ADC14_CTL0_ENC;         // to take the next trigger
+        if(++seqIndex == seqPerChannel){        // Block full
+            publish_Block(seqScratch, seqPosition);
+            seqScratch = next_Block(&seqTarget, &seqPosition);
+            seqIndex = 0;
+        }
+    }
+    TRACE_EXIT(TRACE_ADC14);
 }
 
 int hasNew_ADC(void){
-    return newValue;                            // Return flag value
+    return sampleHead != sampleTail;            // Result waiting
+}
+
+/* get_Sample_ADC()
+ *  Takes the oldest single mode result off the queue
+ *
+ * Returns:
+ *  1 - sample filled in
+ *  0 - No result waiting
+ */
+int get_Sample_ADC(ADCSample * sample){
+    if(sampleHead == sampleTail){
+        return 0;
+    }
+    *sample = SAMPLE_QUEUE[ sampleTail & (ADC_SAMPLES - 1) ];
+    sampleTail++;                               // Slot free once copied
+    lastValue = sample->value;
+    return 1;
+}
+
+unsigned int lost_Sample_ADC(void){
+    return samplesLost;
 }
 
 unsigned int get_Raw_ADC(void){
-    newValue = 0;                               // Clear flag
-    return ADCValue;                            // Return raw unsigned int
+    ADCSample sample;
+    get_Sample_ADC(&sample);                    // Oldest result, or last one again if none
+    return lastValue;                           // Return raw unsigned int
 }
 
 float get_ADC(void){
-    newValue = 0;                               // Clear flag
-    return ((float)ADCValue)*CALIBRATION_VALUE; // Return calibrated value
+    return get_mV_ADC()/1000.0f;                // Return calibrated value in volts
+}
+
+int get_mV_ADC(void){
+    return mV_ADC(get_Raw_ADC(), 14);           // Return calibrated value
+}
+
+/* mV_ADC()
+ *  Converts a reading to millivolts with calibrated Q16 gain and offset,
+ *  one 32x32 multiply and shifts, no float
+ *
+ * Parameters:
+ *  value - Raw or decimated reading
+ *  bits  - Bits in value, 14 for raw, more after oversampling
+ */
+int mV_ADC(unsigned int value, unsigned int bits){
+    const CalData * cal = get_Calibration();
+    long long scaled = ((long long)value*cal->gain) >> (bits - 14);
+    return (int)((scaled + cal->offset + 0x8000) >> 16);    // Rounded
+}
+
+/* raw_ADC()
+ *  Inverse of mV_ADC for 14 bit values, for trigger and limit levels
+ *
+ * Parameters:
+ *  mV - Voltage in millivolts
+ *
+ * Returns:
+ *  Nearest raw value, clamped to 0-ADC_RAW_MAX
+ */
+unsigned int raw_ADC(int mV){
+    const CalData * cal = get_Calibration();
+    long long raw = (((long long)mV << 16) - cal->offset + cal->gain/2)/cal->gain;
+    if(raw < 0){
+        return 0;
+    }
+    return (raw > ADC_RAW_MAX) ? ADC_RAW_MAX : (unsigned int)raw;
 }
 
 void run_ADC(void){
     if(0 == (ADC14->CTL0 & ADC14_CTL0_SC)){     // If System not running
-        ADC14->CTL0 |= ADC14_CTL0_SC;           // Start conversion
-        newValue = 0;                           // Clear flag
+        ADC14->CTL0 |= ADC14_CTL0_SC;           // Start conversion, result is queued
     }
 }
 
 
+
+/* start_Continuous_ADC()
+ *  Starts timer triggered conversions of the same input into DMA blocks
+ *
+ * Parameters:
+ *  rate - Samples per second, ADC_MIN_RATE to ADC_MAX_RATE
+ *
+ * Returns:
+ *  0  - Sampling
+ *  -1 - Rate out of range, nothing changed
+ */
+int start_Continuous_ADC(unsigned int rate){
+    return start_Single(ADC_DEFAULT_INPUT, rate);
+}
+
+/* start_Single()
+ *  Continuous mode body for any one input, see start_Continuous_ADC
+ */
+static int start_Single(unsigned int input, unsigned int rate){
+    if(ADC_MIN_RATE > rate || ADC_MAX_RATE < rate){
+        return -1;
+    }
+    start_Blocks(input, ADC14_CTL0_SHS_1);
+    start_Trigger(rate);
+    return 0;
+}
+
+/* start_Linked_ADC()
+ *  Continuous mode on ADC_DEFAULT_INPUT triggered by TA1.1, rate and
+ *  timing are set by the TA1 owner (sync_Generator). Block sequence
+ *  numbers count from the first TA1.1 edge after this call.
+ *
+ * Returns:
+ *  0 - Waiting for TA1.1 edges
+ */
+int start_Linked_ADC(void){
+    start_Blocks(ADC_DEFAULT_INPUT, ADC14_CTL0_SHS_3);
+    return 0;
+}
+
+/* start_Blocks()
+ *  Sets up DMA ping-pong blocks and repeat single channel conversions
+ *
+ * Parameters:
+ *  input   - Analog input number
+ *  trigger - ADC14_CTL0_SHS_x timer output that starts each conversion
+ */
+static void start_Blocks(unsigned int input, unsigned int trigger){
+    stop_Continuous_ADC();
+
+    blockHead = blockTail = 0;
+    blockArm  = 0;
+    blockChannels = 1;
+    nextDone  = 0;
+    sequence  = 0;
+    overruns  = 0;
+
+    //DMA copies MEM[0] each conversion, primary then alternate block
+    config_Channel_DMA(ADC_DMA_CHANNEL, ADC_DMA_SOURCE);
+    arm_Block(0);
+    arm_Block(1);
+    DMA_Channel->INT2_SRCCFG = DMA_INT2_SRCCFG_EN | ADC_DMA_CHANNEL;
+    NVIC->ISER[1] = 1 << ((DMA_INT2_IRQn) & 31);
+    DMA_Control->ENASET = 1 << ADC_DMA_CHANNEL;
+
+    //Repeat single channel, each rising edge of trigger starts the sample timer
+    ADC14->CTL0 &= ~ADC14_CTL0_ENC;
+    ADC14->CTL0  = ADC14_CTL0_SHT0_2  | ADC14_CTL0_SHP      |
+                   ADC14_CTL0_PDIV__4 | trigger             |
+                   ADC14_CTL0_CONSEQ_2| ADC14_CTL0_ON;
+    ADC14->MCTL[0] = input;
+    ADC14->IER0  = 0;                                       // DMA reads results, no ADC interrupt
+    ADC14->CTL0 |= ADC14_CTL0_ENC;
+    select_Input(input);
+}
+
+/* start_Sequence_ADC()
+ *  Starts timer triggered scans of several inputs. Each trigger converts
+ *  the whole list back to back into MEM[0..count-1], the ADC interrupt at
+ *  end of sequence copies them out so each channel is contiguous in the
+ *  block (channel n starts at samples + n*count).
+ *
+ * Parameters:
+ *  inputs - Analog input numbers, 0-23 for A0-A23
+ *  count  - Number of inputs, 1 to ADC_MAX_CHANNELS
+ *  rate   - Scans per second, rate*count at most ADC_MAX_RATE
+ *
+ * Returns:
+ *  0  - Sampling
+ *  -1 - Bad list or rate, nothing changed
+ */
+int start_Sequence_ADC(const unsigned char * inputs, unsigned int count, unsigned int rate){
+    unsigned int channel;
+    if(0 == count || ADC_MAX_CHANNELS < count ||
+       ADC_MIN_RATE > rate || ADC_MAX_RATE/count < rate){
+        return -1;
+    }
+    for(channel = 0; channel < count; channel++){
+        if(ADC_INPUTS <= inputs[channel]){
+            return -1;
+        }
+    }
+    if(1 == count){                                         // DMA handles single inputs
+        return start_Single(inputs[0], rate);
+    }
+    stop_Continuous_ADC();
+
+    blockHead = blockTail = 0;
+    blockArm  = 0;
+    sequence  = 0;
+    overruns  = 0;
+    blockChannels = count;
+    seqPerChannel = ADC_BLOCK_SIZE/count;
+    seqIndex      = 0;
+    seqScratch    = next_Block(&seqTarget, &seqPosition);
+
+    //One MCTL per input, last one ends the sequence
+    ADC14->CTL0 &= ~ADC14_CTL0_ENC;
+    for(channel = 0; channel < count; channel++){
+        ADC14->MCTL[channel] = inputs[channel] | (channel == count - 1 ? ADC14_MCTLN_EOS : 0);
+        select_Input(inputs[channel]);
+    }
+    //Single sequence, TA0.1 edge starts it and MSC runs the rest without waiting
+    ADC14->CTL0  = ADC14_CTL0_SHT0_2  | ADC14_CTL0_SHP      |
+                   ADC14_CTL0_PDIV__4 | ADC14_CTL0_SHS_1    |
+                   ADC14_CTL0_MSC     | ADC14_CTL0_CONSEQ_1 |
+                   ADC14_CTL0_ON;
+    ADC14->CLRIFGR0 = 0xFFFFFFFF;
+    ADC14->IER0  = 1 << (count - 1);                        // One interrupt per sequence
+    seqChannels  = count;
+    ADC14->CTL0 |= ADC14_CTL0_ENC;
+
+    start_Trigger(rate);
+    return 0;
+}
+
+/* start_Sample_ADC()
+ *  Starts timer triggered conversions of ADC_DEFAULT_INPUT, each result
+ *  goes to handler from the ADC interrupt. Handler must finish within
+ *  one sample period.
+ *
+ * Parameters:
+ *  rate    - Samples per second, ADC_MIN_RATE to ADC_MAX_RATE
+ *  handler - Function given each raw 14 bit result
+ *
+ * Returns:
+ *  0  - Sampling
+ *  -1 - Rate out of range or no handler, nothing changed
+ */
+int start_Sample_ADC(unsigned int rate, SampleHandler handler){
+    if(ADC_MIN_RATE > rate || ADC_MAX_RATE < rate || 0 == handler){
+        return -1;
+    }
+    stop_Continuous_ADC();
+    overruns = 0;
+
+    //Repeat single channel like continuous mode, interrupt instead of DMA
+    ADC14->CTL0 &= ~ADC14_CTL0_ENC;
+    ADC14->CTL0  = ADC14_CTL0_SHT0_2  | ADC14_CTL0_SHP      |
+                   ADC14_CTL0_PDIV__4 | ADC14_CTL0_SHS_1    |
+                   ADC14_CTL0_CONSEQ_2| ADC14_CTL0_ON;
+    ADC14->MCTL[0] = ADC_DEFAULT_INPUT;
+    ADC14->CLRIFGR0 = 0xFFFFFFFF;
+    ADC14->CLRIFGR1 = ADC14_CLRIFGR1_CLROVIFG;
+    ADC14->IER0  = ADC14_IER0_IE0;
+    sampleHandler = handler;
+    ADC14->CTL0 |= ADC14_CTL0_ENC;
+
+    start_Trigger(rate);
+    return 0;
+}
+
+/* trigger_Age_ADC()
+ *  For latency measurement in a sample handler
+ *
+ * Returns:
+ *  ADC_TIMER_CLOCK ticks since the last TA0.1 rising edge, valid for
+ *  less than one sample period
+ */
+unsigned int trigger_Age_ADC(void){
+    unsigned int now  = TIMER_A0->R;
+    unsigned int edge = TIMER_A0->CCR[1];
+    return (now >= edge) ? now - edge : now + TIMER_A0->CCR[0] + 1 - edge;
+}
+
+/* start_Monitor_ADC()
+ *  Starts timer triggered conversions of one input with the window
+ *  comparator, crossings are queued for get_Event_ADC. The first
+ *  conversion always gives an event with the starting zone.
+ *
+ * Parameters:
+ *  input - Analog input number, 0-23 for A0-A23
+ *  rate  - Samples per second, ADC_MIN_RATE to ADC_MAX_RATE
+ *  low   - Raw low limit, results under it are below
+ *  high  - Raw high limit, results over it are above
+ *
+ * Returns:
+ *  0  - Monitoring
+ *  -1 - Bad input, rate or limits, nothing changed
+ */
+int start_Monitor_ADC(unsigned int input, unsigned int rate, unsigned int low, unsigned int high){
+    if(ADC_INPUTS <= input || ADC_MIN_RATE > rate || ADC_MAX_RATE < rate ||
+       low > high || ADC_RAW_MAX < high){
+        return -1;
+    }
+    stop_Continuous_ADC();
+    eventHead = eventTail = 0;
+    eventsMissed = 0;
+
+    //Repeat single channel, comparator on MEM[0] with HI0/LO0
+    ADC14->CTL0 &= ~ADC14_CTL0_ENC;
+    ADC14->CTL0  = ADC14_CTL0_SHT0_2  | ADC14_CTL0_SHP      |
+                   ADC14_CTL0_PDIV__4 | ADC14_CTL0_SHS_1    |
+                   ADC14_CTL0_CONSEQ_2| ADC14_CTL0_ON;
+    ADC14->MCTL[0] = input | ADC14_MCTLN_WINC;
+    ADC14->LO0   = low;
+    ADC14->HI0   = high;
+    ADC14->IER0  = 0;                                       // No interrupt per conversion
+    ADC14->CLRIFGR1 = ADC14_CLRIFGR1_CLRHIIFG | ADC14_CLRIFGR1_CLRLOIFG |
+                      ADC14_CLRIFGR1_CLRINIFG;
+    ADC14->IER1  = WINDOW_FLAGS;                            // Zone unknown until first result
+    monitoring   = 1;
+    ADC14->CTL0 |= ADC14_CTL0_ENC;
+    select_Input(input);
+
+    start_Trigger(rate);
+    return 0;
+}
+
+/* get_Event_ADC()
+ *
+ * Returns:
+ *  1 - event filled in with oldest crossing
+ *  0 - No crossing waiting
+ */
+int get_Event_ADC(ADCEvent * event){
+    if(eventTail == eventHead){
+        return 0;
+    }
+    *event = events[ eventTail & (ADC_EVENTS - 1) ];
+    eventTail++;
+    return 1;
+}
+
+unsigned int available_Event_ADC(void){
+    return eventHead - eventTail;
+}
+
+unsigned int missed_Event_ADC(void){
+    return eventsMissed;
+}
+
+/* window_Event()
+ *  Comparator interrupt, queues the zone entered and listens for the other
+ *  two. Zone comes from the result itself in case flags for two crossings
+ *  built up before the interrupt ran.
+ */
+static void window_Event(void){
+    static const unsigned int ZONE_FLAG[3] = {ADC14_IER1_LOIE, ADC14_IER1_INIE, ADC14_IER1_HIIE};
+    unsigned int flags = ADC14->IFGR1 & ADC14->IER1 & WINDOW_FLAGS;
+    unsigned int value = ADC14->MEM[0];
+    ADCEvent * event;
+    ADCZone zone;
+
+    ADC14->CLRIFGR1 = ADC14_CLRIFGR1_CLRHIIFG | ADC14_CLRIFGR1_CLRLOIFG |
+                      ADC14_CLRIFGR1_CLRINIFG;
+    if(0 == flags){
+        return;
+    }
+    zone = (value > ADC14->HI0) ? above : (value < ADC14->LO0) ? below : inside;
+    ADC14->IER1 = WINDOW_FLAGS & ~ZONE_FLAG[zone];          // Wait to leave this zone
+    if(eventHead - eventTail >= ADC_EVENTS){                // Queue full, zone still tracked
+        eventsMissed++;
+        return;
+    }
+    event = &events[ eventHead & (ADC_EVENTS - 1) ];
+    event->zone  = zone;
+    event->value = value;
+    eventHead++;
+}
+
+/* start_Trigger()
+ *  TA0 up mode, CCR1 set/reset gives one rising edge per period
+ */
+static void start_Trigger(unsigned int rate){
+    unsigned int period = ADC_TIMER_CLOCK/rate;
+    TIMER_A0->CTL     = TIMER_A_CTL_SSEL__SMCLK | TIMER_A_CTL_CLR;
+    TIMER_A0->CCR[0]  = period - 1;
+    TIMER_A0->CCR[1]  = period/2;
+    TIMER_A0->CCTL[1] = TIMER_A_CCTLN_OUTMOD_3;
+    TIMER_A0->CTL    |= TIMER_A_CTL_MC__UP;
+}
+
+/* select_Input()
+ *  Gives an analog input pin to the ADC (tertiary function)
+ *
+ * Parameters:
+ *  input - 0-23 for A0-A23
+ */
+static void select_Input(unsigned int input){
+    unsigned char pin = 1 << (INPUT_PINS[input] & 0x0F);
+    switch(INPUT_PINS[input] >> 4){
+    case 4:
+        P4->SEL0 |= pin;
+        P4->SEL1 |= pin;
+        break;
+    case 5:
+        P5->SEL0 |= pin;
+        P5->SEL1 |= pin;
+        break;
+    case 6:
+        P6->SEL0 |= pin;
+        P6->SEL1 |= pin;
+        break;
+    case 8:
+        P8->SEL0 |= pin;
+        P8->SEL1 |= pin;
+        break;
+    case 9:
+        P9->SEL0 |= pin;
+        P9->SEL1 |= pin;
+        break;
+    }
+}
+
+/* stop_Continuous_ADC()
+ *  Stops continuous or sequence mode, blocks not yet read are lost,
+ *  single conversion mode on ADC_DEFAULT_INPUT is restored
+ */
+void stop_Continuous_ADC(void){
+    unsigned int channel;
+    TIMER_A0->CTL &= ~TIMER_A_CTL_MC_MASK;                  // No more triggers
+    DMA_Control->ENACLR = 1 << ADC_DMA_CHANNEL;
+    DMA_Channel->INT2_SRCCFG = 0;
+    ADC14->CTL0 &= ~ADC14_CTL0_ENC;
+    for(channel = 1; channel < ADC_MAX_CHANNELS; channel++){
+        ADC14->MCTL[channel] = 0;                           // Drop sequence end markers
+    }
+    init_ADC();                                             // Back to software started conversions
+}
+
+/* get_Block_ADC()
+ *  Returns oldest full block, block stays valid until release_Block_ADC
+ *
+ * Returns:
+ *  1 - block filled in
+ *  0 - No full block waiting
+ */
+int get_Block_ADC(ADCBlock * block){
+    unsigned int slot = blockTail & (ADC_BLOCKS - 1);
+    if(blockHead == blockTail){
+        return 0;
+    }
+    block->samples  = BLOCK_DATA[slot];
+    block->count    = ADC_BLOCK_SIZE/blockChannels;
+    block->channels = blockChannels;
+    block->sequence = blockSequence[slot];
+    return 1;
+}
+
+void release_Block_ADC(void){
+    if(blockHead != blockTail){
+        blockTail++;                                        // Slot may now be armed again
+    }
+}
+
+unsigned int overrun_ADC(void){
+    return overruns;                                        // Blocks captured into scratch
+}
+
+/* next_Block()
+ *  Takes the next free block, or scratch if the app still holds all of them
+ *
+ * Parameters:
+ *  target   - Set to block storage
+ *  position - Set to block position, unchanged for scratch
+ *
+ * Returns:
+ *  1 if target is scratch
+ */
+static int next_Block(unsigned short ** target, unsigned int * position){
+    if(blockArm - blockTail < ADC_BLOCKS){                  // Slot free
+        *target   = BLOCK_DATA[blockArm & (ADC_BLOCKS - 1)];
+        *position = blockArm++;
+        return 0;
+    }
+    *target = SCRATCH_DATA;
+    return 1;
+}
+
+/* publish_Block()
+ *  Hands a full block to the app, or counts it lost if it was scratch.
+ *  Blocks complete in the order they were taken so head only moves forward.
+ */
+static void publish_Block(int scratch, unsigned int position){
+    if(!scratch){
+        blockSequence[position & (ADC_BLOCKS - 1)] = sequence;
+        blockHead = position + 1;
+    }else{
+        overruns++;
+    }
+    sequence++;
+}
+
+/* arm_Block()
+ *  Points a control structure at the next free block or scratch.
+ *  Only called before start or from the DMA ISR.
+ *
+ * Parameters:
+ *  alternate - 0 for primary structure, 1 for alternate
+ */
+static void arm_Block(int alternate){
+    DMAControl * control = &DMA_TABLE[ADC_DMA_CHANNEL + (alternate ? DMA_CHANNELS : 0)];
+    unsigned short * target;
+    armedScratch[alternate] = next_Block(&target, &armedPosition[alternate]);
+    control->srcEnd  = (volatile void *)&ADC14->MEM[0];
+    control->dstEnd  = (volatile void *)&target[ADC_BLOCK_SIZE - 1];
+    control->control = DMA_CW_DST_INC_HALF | DMA_CW_DST_SIZE_HALF |
+                       DMA_CW_SRC_INC_NONE | DMA_CW_SRC_SIZE_HALF |
+                       DMA_CW_ARB_1        | DMA_CW_N(ADC_BLOCK_SIZE) |
+                       DMA_CW_MODE_PINGPONG;
+}
+
+/* DMA_INT2_IRQHandler()
+ *  Runs once per full block. Structures finish in turn, so the one that
+ *  just finished is re-armed while the other one fills.
+ */
+void DMA_INT2_IRQHandler(void){
+    TRACE_ENTER(TRACE_DMA);
+    PROFILE_START(PROBE_BLOCK);
+    DMA_Channel->INT0_CLRFLG = 1 << ADC_DMA_CHANNEL;        // Clear flag
+    publish_Block(armedScratch[nextDone], armedPosition[nextDone]);
+    arm_Block(nextDone);
+    nextDone ^= 1;
+    PROFILE_STOP(PROBE_BLOCK);
+    TRACE_EXIT(TRACE_DMA);
+}
@@ -3,14 +3,64 @@
  *
  *   This libary holds functions for ADC, specifically for assignment 8
  *      init_ADC    - Configures ADC
- *      hasNew_ADC  - Returns whether ADC has a new value
- *      get_Raw_ADC - Returns direct value from ADC
+ *      hasNew_ADC  - Returns whether a result is waiting
+ *      get_Sample_ADC - Returns oldest result with sequence and timestamp
+ *      lost_Sample_ADC - Returns results lost because the queue was full
+ *      get_Raw_ADC - Returns oldest result as a direct value from ADC
  *      get_ADC     - Returns value in volts, 3.3 max
+ *      get_mV_ADC  - Returns value in millivolts, integer math only
+ *      mV_ADC      - Converts a raw or oversampled value to millivolts
+ *      raw_ADC     - Converts millivolts to the nearest raw value
  *      run_ADC     - Starts another conversion
+ *      start_Continuous_ADC - Samples at a fixed rate into blocks by DMA
+ *      start_Sequence_ADC   - Scans a list of inputs at a fixed rate into blocks
+ *      start_Sample_ADC     - Samples at a fixed rate, calls a handler each sample
+ *      start_Linked_ADC     - Samples into blocks on another timer's edges
+ *      trigger_Age_ADC      - Timer clocks since the current sample was triggered
+ *      start_Monitor_ADC    - Watches one input against limits in hardware
+ *      get_Event_ADC        - Returns oldest limit crossing, non-blocking
+ *      available_Event_ADC  - Returns number of crossings waiting
+ *      missed_Event_ADC     - Returns crossings lost because the queue was full
+ *      stop_Continuous_ADC  - Goes back to single conversions
+ *      get_Block_ADC        - Returns oldest full block, non-blocking
+ *      release_Block_ADC    - Hands oldest block back for filling
+ *      overrun_ADC          - Returns blocks (samples in sample mode) lost
  *
+ *   Single mode: every result goes into an ADC_SAMPLES queue with a
+ *   sequence number and the cycle count (Cycles.h) when it was read out,
+ *   so each result is read once, gaps in sequence show results lost to a
+ *   full queue and get_Cycles() - timestamp is the delay to the consumer.
+ *
+ *   Continuous mode: TA0 CCR1 output triggers each conversion so sample
+ *   timing does not depend on software. DMA channel 7 moves results in
+ *   ping-pong mode, each half fills one of ADC_BLOCKS blocks. When the app
+ *   still holds every block the next one is captured into a scratch block
+ *   and dropped, the sequence number still counts it so gaps show loss.
+ *
+ *   Sequence mode: each trigger converts a list of inputs back to back
+ *   through MCTL[0..n-1] ending in EOS, one ADC interrupt per scan copies
+ *   them out. Blocks hold each channel contiguously, channel n of a block
+ *   starts at samples + n*count.
+ *
+ *   Linked mode: continuous mode triggered by TA1.1 instead of TA0.1, so
+ *   samples line up with whatever owns TA1 (Function_Generator.h).
+ *
+ *   Sample mode: same trigger as continuous mode but the ADC interrupt
+ *   passes each result to a handler instead of DMA, for processing with a
+ *   fixed delay. A result not read before the next conversion ends counts
+ *   as an overrun.
+ *
+ *   Monitor mode: same trigger, the window comparator checks each result
+ *   against LO0 and HI0 with no interrupt per sample. Only the flags for
+ *   the two zones the input is not in are enabled, so the ADC interrupts
+ *   once per crossing and the CPU can sleep in between. Comparator flags
+ *   are shared by every memory register, so one input is watched at a time.
  *
  * Depenedencies:
  *   MSP.h -  Needed for direct register access
+ *   DMA.h -  Shared control table
+ *   Calibration.h - Gain and offset for millivolt conversion
+ *   Cycles.h - Sample timestamps
  *
  * Errors:
  *   None Currently May 10, 2017
@@ -18,6 +68,15 @@
  * Revisions:
  *   May 10, 2017 - Initial Creation
  *   May 12, 2017 - Cleaned and commented
+ *   Oct 19, 2026 - Timer triggered continuous mode with DMA blocks
+ *   Oct 19, 2026 - Multi-channel sequence mode
+ *   Oct 19, 2026 - volts_ADC for decimated values
+ *   Oct 19, 2026 - Calibrated integer millivolts replace volts_ADC
+ *   Oct 19, 2026 - Per sample handler mode
+ *   Oct 19, 2026 - raw_ADC for thresholds given in millivolts
+ *   Oct 19, 2026 - Window comparator monitor mode
+ *   Oct 19, 2026 - Single results queued with sequence and timestamp
+ *   Oct 19, 2026 - Linked mode on TA1.1 for generator synchronous sampling
  *
  *  Author: Drew Hartley, Jordan Jones
  *
@@ -26,14 +85,81 @@
 #ifndef ADC_H_
 #define ADC_H_
 #include "msp.h"
+#include "DMA.h"
+#include "Calibration.h"
+
+#define ADC_BLOCK_SIZE      256         // Samples per block, up to DMA_MAX_TRANSFERS
+#define ADC_BLOCKS          4           // Must be a power of two, at least 2
+#define ADC_TIMER_CLOCK     48000000    // SMCLK
+#define ADC_MIN_RATE        (ADC_TIMER_CLOCK/65536 + 1) // 16 bit period
+#define ADC_CLOCK           (25000000/4)    // MODCLK with PDIV__4
+#define ADC_SAMPLE_CLOCKS   16          // SHT0_2
+#define ADC_CONVERT_CLOCKS  (14 + 2)    // 14 bit conversion
+#define ADC_SYNC_CLOCKS     1           // Margin for trigger sync, keeps a trigger from landing on a busy ADC
+#define ADC_MAX_RATE        (ADC_CLOCK/(ADC_SAMPLE_CLOCKS + ADC_CONVERT_CLOCKS + ADC_SYNC_CLOCKS)) // 189 kHz
+#define ADC_DMA_CHANNEL     7           // Channel 7 source 7 is ADC14
+#define ADC_DMA_SOURCE      7
+#define ADC_INPUTS          24          // A0-A23
+#define ADC_MAX_CHANNELS    8           // Longest sequence
+#define ADC_DEFAULT_INPUT   1           // A1 on P5.4, single and continuous modes
+#define ADC_RAW_MAX         16383       // 14 bit result
+#define ADC_EVENTS          16          // Queued limit crossings, power of two
+#define ADC_SAMPLES         16          // Queued single results, power of two
 
+//Data struct for one full block
+typedef struct{
+    const unsigned short * samples;     // Raw 14 bit results, one channel after another
+    unsigned int           count;       // Samples per channel
+    unsigned int           channels;    // 1 except in sequence mode
+    unsigned int           sequence;    // Counts every block, dropped ones too
+}ADCBlock;
+
+//Data struct for one single mode result
+typedef struct{
+    unsigned int value;                 // Raw 14 bit result
+    unsigned int sequence;              // Counts every conversion, lost ones too
+    unsigned int timestamp;             // get_Cycles() in the ADC interrupt
+}ADCSample;
+
+//Monitor zones, relative to the limits
+typedef enum{
+    below,                              // Under low limit
+    inside,                             // Low to high limit
+    above                               // Over high limit
+}ADCZone;
+
+//Data struct for one limit crossing
+typedef struct{
+    ADCZone      zone;                  // Zone entered
+    unsigned int value;                 // Raw result that crossed
+}ADCEvent;
+
+//Called from the ADC interrupt with each raw result in sample mode
+typedef void (*SampleHandler)(unsigned int raw);
 
 void init_ADC(void);
 int hasNew_ADC(void);
+int  get_Sample_ADC(ADCSample * sample);
+unsigned int lost_Sample_ADC(void);
 unsigned int get_Raw_ADC(void);
 float get_ADC(void);
+int  get_mV_ADC(void);
+int  mV_ADC(unsigned int value, unsigned int bits);
+unsigned int raw_ADC(int mV);
 void run_ADC(void);
-
+int  start_Continuous_ADC(unsigned int rate);
+int  start_Sequence_ADC(const unsigned char * inputs, unsigned int count, unsigned int rate);
+int  start_Linked_ADC(void);
+int  start_Sample_ADC(unsigned int rate, SampleHandler handler);
+unsigned int trigger_Age_ADC(void);
+int  start_Monitor_ADC(unsigned int input, unsigned int rate, unsigned int low, unsigned int high);
+int  get_Event_ADC(ADCEvent * event);
+unsigned int available_Event_ADC(void);
+unsigned int missed_Event_ADC(void);
+void stop_Continuous_ADC(void);
+int  get_Block_ADC(ADCBlock * block);
+void release_Block_ADC(void);
+unsigned int overrun_ADC(void);
 
 
 #endif /* ADC_H_ */
@@ -0,0 +1,133 @@
+/*
+ *  Analyzer.c
+ *    This holds the synchronous single bin DFT for the network analyzer
+ *    See Analyzer.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Analyzer.h"
+#include "FFT.h"
+#include <math.h>
+
+#define PI 3.14159265f
+
+static unsigned int pointFreq;
+static unsigned int first;                  // First ADC sample summed
+static unsigned int length;                 // Samples to sum
+static unsigned int summed;
+static long long sumCos, sumSin;            // Sample times reference, Q15
+static long long refCos, refSin;            // Reference alone, for DC removal
+static long long sumRaw;
+
+/* start_Analyzer()
+ *  Switches the generator to a sine at freq, keeping amplitude and offset,
+ *  and restarts generator and ADC together
+ *
+ * Parameters:
+ *  freq - Hz, 1 to GEN_MAX_FREQ
+ *
+ * Returns:
+ *  0  - Measuring
+ *  -1 - Frequency out of range, nothing changed
+ */
+int start_Analyzer(unsigned int freq){
+    WaveData wave;
+    unsigned long long step;
+    unsigned long long periods;
+
+    get_Wave_Generator(&wave);
+    wave.form = sine;
+    wave.freq = freq;
+    if(set_Wave_Generator(&wave)){
+        return -1;
+    }
+
+    //Whole periods covering at least ANALYZER_SAMPLES, ends within half a sample
+    step    = ((unsigned long long)freq << 32)/GEN_SAMPLE_RATE;     // As the generator steps
+    periods = (ANALYZER_SAMPLES*step + (1ull << 32) - 1) >> 32;
+    length  = (unsigned int)(((periods << 32) + step/2)/step);
+    first   = (unsigned int)(((1ull << 32) + step - 1)/step);  // One period
+    if(first < ANALYZER_SETTLE){
+        first = ANALYZER_SETTLE;
+    }
+    pointFreq = freq;
+    summed = 0;
+    sumCos = sumSin = refCos = refSin = sumRaw = 0;
+
+    output_Generator(0);                    // No trigger edges until sync
+    start_Linked_ADC();
+    sync_Generator();
+    return 0;
+}
+
+/* update_Analyzer()
+ *
+ * Parameters:
+ *  block - Next block from get_Block_ADC, caller releases it
+ *
+ * Returns:
+ *  1 - Point done, read result_Analyzer
+ *  0 - More blocks needed
+ */
+int update_Analyzer(const ADCBlock * block){
+    unsigned int index = block->sequence*ADC_BLOCK_SIZE;    // ADC sample number of samples[0]
+    unsigned int i;
+
+    for(i = 0; i < block->count && summed < length; i++, index++){
+        unsigned int angle;
+        int c, s;
+        int x;
+        if(index < first){
+            continue;
+        }
+        //Stimulus phase of DAC sample index-1, top 10 bits index the 1024 point twiddles
+        angle = phase_Generator(index - 1) >> (32 - FFT_BITS);
+        if(angle < FFT_SIZE/2){
+            c =  FFT_TWIDDLE[2*angle];
+            s =  FFT_TWIDDLE[2*angle + 1];
+        }else{
+            c = -FFT_TWIDDLE[2*(angle - FFT_SIZE/2)];
+            s = -FFT_TWIDDLE[2*(angle - FFT_SIZE/2) + 1];
+        }
+        x = block->samples[i];
+        sumCos += (long long)x*c;
+        sumSin += (long long)x*s;
+        refCos += c;
+        refSin += s;
+        sumRaw += x;
+        summed++;
+    }
+    return summed >= length;
+}
+
+/* result_Analyzer()
+ *  Removes DC left by the period rounding and converts to mV, dB and
+ *  degrees. Float is fine here, once per point.
+ */
+void result_Analyzer(AnalyzerResult * result){
+    WaveData wave;
+    float mean = (float)sumRaw/summed;
+    float i = ((float)sumCos - mean*(float)refCos)/32768.0f;
+    float q = ((float)sumSin - mean*(float)refSin)/32768.0f;
+    float peak = 2.0f*sqrtf(i*i + q*q)/summed;                  // Raw counts
+    float mV = peak*get_Calibration()->gain/65536.0f;           // Gain only, offset is DC
+
+    get_Wave_Generator(&wave);
+    result->freq         = pointFreq;
+    result->samples      = summed;
+    result->amplitude    = (int)(mV + 0.5f);
+    result->centiDB      = (mV > 0.0f && wave.amplitude) ?
+                           (int)lroundf(2000.0f*log10f(2.0f*mV/wave.amplitude)) : -32768;
+    result->centiDegrees = (int)lroundf(atan2f(-q, i)*18000.0f/PI);   // x = A cos(phase + theta)
+}
+
+void stop_Analyzer(void){
+    stop_Continuous_ADC();
+    output_Generator(0);
+}
@@ -0,0 +1,58 @@
+/*
+ * Analyzer.h
+ *
+ *   This libary holds a network analyzer, generator sine in, ADC response out
+ *      start_Analyzer  - Starts one frequency point
+ *      update_Analyzer - Feeds an ADC block, returns 1 when the point is done
+ *      result_Analyzer - Returns amplitude, gain and phase of the point
+ *      stop_Analyzer   - Stops ADC and generator output
+ *
+ *   The generator is restarted at phase 0 and the ADC is triggered from
+ *   the generator's own timer (sync_Generator, start_Linked_ADC), so ADC
+ *   sample k sees DAC sample k-1 and its stimulus phase is known exactly.
+ *   Each sample is multiplied by the cos and sin of that phase (single bin
+ *   DFT) over a whole number of periods, at least ANALYZER_SAMPLES samples,
+ *   after ANALYZER_SETTLE samples for the circuit to settle.
+ *
+ *   Phase includes the DAC to ADC path (half a sample period from
+ *   update to conversion plus the DAC hold), measure a wire from DAC to
+ *   ADC first and subtract it to get the circuit alone.
+ *
+ * Depenedencies:
+ *   ADC.h                - Linked mode blocks
+ *   Function_Generator.h - Stimulus and phase
+ *   FFT.h                - Q15 cos and sin table
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef ANALYZER_H_
+#define ANALYZER_H_
+#include "ADC.h"
+#include "Function_Generator.h"
+
+#define ANALYZER_SAMPLES    4096        // Least samples summed per point
+#define ANALYZER_SETTLE     ADC_BLOCK_SIZE  // Least samples skipped, one period if longer
+
+//Data struct for one frequency point
+typedef struct{
+    unsigned int freq;                  // Hz
+    unsigned int samples;               // Samples summed
+    int          amplitude;             // Response peak, mV
+    int          centiDB;               // Response over stimulus, 0.01 dB
+    int          centiDegrees;          // Response phase minus stimulus, -18000 to 18000
+}AnalyzerResult;
+
+int  start_Analyzer(unsigned int freq);
+int  update_Analyzer(const ADCBlock * block);
+void result_Analyzer(AnalyzerResult * result);
+void stop_Analyzer(void);
+
+#endif /* ANALYZER_H_ */
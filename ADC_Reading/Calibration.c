@@ -0,0 +1,200 @@
+/*
+ *  Calibration.c
+ *    This holds ADC calibration values and the flash record
+ *    See Calibration.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *   Oct 19, 2026 - DAC curve record saved alongside ADC values
+ *   Oct 19, 2026 - Boot override mailbox kept across the sector erase
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Calibration.h"
+
+static CalData current = {CAL_MAGIC, CAL_NOMINAL_GAIN, 0, 0};
+static int fromFlash;
+static DacCal dacCurve;                                     // Zero magic until measured or loaded
+static unsigned int pointReading[2];                        // Q CAL_POINT_BITS counts
+static int pointMV[2];
+static unsigned int keep[ CAL_KEEP_WORDS ];                 // Sector below the records while it is erased
+
+static int check_Record(const CalData * record);
+static unsigned int check_DAC(const DacCal * record);
+static void program_Words(volatile unsigned int * flash, const unsigned int * words, unsigned int count);
+
+void init_Calibration(void){
+    const CalData * stored = (const CalData *)CAL_ADDRESS;
+    const DacCal * curve = (const DacCal *)CAL_DAC_ADDRESS;
+    if(check_Record(stored)){                               // Erased flash fails the check
+        current   = *stored;
+        fromFlash = 1;
+    }
+    if(CAL_DAC_MAGIC == curve->magic && curve->check == check_DAC(curve)){
+        dacCurve = *curve;
+    }
+}
+
+const CalData * get_Calibration(void){
+    return &current;
+}
+
+int saved_Calibration(void){
+    return fromFlash;
+}
+
+/* set_DAC_Calibration()
+ *  Curve takes effect on the next mV_DAC call, kept over reset once saved
+ *
+ * Parameters:
+ *  mV - DAC_CAL_POINTS outputs, Q DAC_CAL_BITS, non-decreasing
+ */
+void set_DAC_Calibration(const unsigned short * mV){
+    unsigned int i;
+    for(i = 0; i < DAC_CAL_POINTS; i++){
+        dacCurve.mV[i] = mV[i];
+    }
+    dacCurve.magic = CAL_DAC_MAGIC;
+    dacCurve.check = check_DAC(&dacCurve);
+}
+
+const DacCal * get_DAC_Calibration(void){
+    return (CAL_DAC_MAGIC == dacCurve.magic) ? &dacCurve : 0;
+}
+
+/* set_Point_Calibration()
+ *
+ * Parameters:
+ *  index   - 0 for low point, 1 for high point
+ *  reading - Averaged raw reading with CAL_POINT_BITS fraction bits
+ *  mV      - Voltage applied while reading
+ */
+void set_Point_Calibration(unsigned int index, unsigned int reading, int mV){
+    if(index < 2){
+        pointReading[index] = reading;
+        pointMV[index]      = mV;
+    }
+}
+
+/* solve_Calibration()
+ *  Line through both points, values take effect right away but are only
+ *  kept over reset once saved
+ *
+ * Returns:
+ *  0  - No Error
+ *  -1 - Points missing or too close together
+ */
+int solve_Calibration(void){
+    long long span = (long long)pointReading[1] - pointReading[0];
+    long long gain;
+    if(span < (16 << CAL_POINT_BITS) && span > -(16 << CAL_POINT_BITS)){
+        return -1;                                          // Under 16 counts apart, mostly noise
+    }
+    gain = ((long long)(pointMV[1] - pointMV[0]) << (16 + CAL_POINT_BITS))/span;
+    current.gain   = (int)gain;
+    current.offset = (int)(((long long)pointMV[0] << 16) -
+                           ((gain*pointReading[0]) >> CAL_POINT_BITS));
+    current.magic  = CAL_MAGIC;
+    current.check  = ~(current.magic ^ (unsigned int)current.gain ^ (unsigned int)current.offset);
+    fromFlash = 0;
+    return 0;
+}
+
+/* save_Calibration()
+ *  Erases calibration sector and programs both records a word at a time,
+ *  then reads them back. Words below CAL_ADDRESS, the boot override
+ *  mailbox, are copied first and programmed back unless erased. A DAC
+ *  curve never measured is written as is and fails its check on the next
+ *  load.
+ *
+ * Returns:
+ *  0  - No Error
+ *  -1 - Flash erase or program failed
+ */
+int save_Calibration(void){
+    const unsigned int * words = (const unsigned int *)&current;
+    const unsigned int * dacWords = (const unsigned int *)&dacCurve;
+    unsigned int state = __get_PRIMASK();
+    unsigned int i;
+    int result = 0;
+
+    current.check = ~(current.magic ^ (unsigned int)current.gain ^ (unsigned int)current.offset);
+    for(i = 0; i < CAL_KEEP_WORDS; i++){
+        keep[i] = ((volatile unsigned int *)CAL_SECTOR)[i];
+    }
+
+    __disable_irq();                                        // Bank 0 reads stall during erase
+    FLCTL->BANK0_INFO_WEPROT &= ~FLCTL_BANK0_INFO_WEPROT_PROT0;
+
+    //Sector erase of info memory
+    FLCTL->CLRIFG         = 0xFFFFFFFF;
+    FLCTL->ERASE_SECTADDR = CAL_SECTOR;
+    FLCTL->ERASE_CTLSTAT  = FLCTL_ERASE_CTLSTAT_TYPE_1 | FLCTL_ERASE_CTLSTAT_START;
+    while(FLCTL_ERASE_CTLSTAT_STATUS_MASK !=                // Status 3 is erase complete
+          (FLCTL->ERASE_CTLSTAT & FLCTL_ERASE_CTLSTAT_STATUS_MASK));
+    FLCTL->ERASE_CTLSTAT = FLCTL_ERASE_CTLSTAT_CLR_STAT;
+
+    for(i = 0; i < CAL_KEEP_WORDS; i++){
+        if(0xFFFFFFFF != keep[i]){                          // Already erased, nothing to program
+            program_Words((volatile unsigned int *)CAL_SECTOR + i, &keep[i], 1);
+        }
+    }
+    program_Words((volatile unsigned int *)CAL_ADDRESS, words, sizeof(CalData)/4);
+    program_Words((volatile unsigned int *)CAL_DAC_ADDRESS, dacWords, sizeof(DacCal)/4);
+
+    FLCTL->BANK0_INFO_WEPROT |= FLCTL_BANK0_INFO_WEPROT_PROT0;
+    __set_PRIMASK(state);
+
+    for(i = 0; i < CAL_KEEP_WORDS; i++){                    // Read back
+        if(((volatile unsigned int *)CAL_SECTOR)[i] != keep[i]){
+            result = -1;
+        }
+    }
+    for(i = 0; i < sizeof(CalData)/4; i++){
+        if(((volatile unsigned int *)CAL_ADDRESS)[i] != words[i]){
+            result = -1;
+        }
+    }
+    for(i = 0; i < sizeof(DacCal)/4; i++){
+        if(((volatile unsigned int *)CAL_DAC_ADDRESS)[i] != dacWords[i]){
+            result = -1;
+        }
+    }
+    fromFlash = (0 == result);
+    return result;
+}
+
+/* program_Words()
+ *  Immediate word programming, each write starts one program cycle.
+ *  Sector must be erased and unprotected.
+ */
+static void program_Words(volatile unsigned int * flash, const unsigned int * words, unsigned int count){
+    unsigned int i;
+    FLCTL->PRG_CTLSTAT = FLCTL_PRG_CTLSTAT_ENABLE;
+    for(i = 0; i < count; i++){
+        flash[i] = words[i];
+        while(FLCTL->PRG_CTLSTAT & FLCTL_PRG_CTLSTAT_STATUS_MASK);
+    }
+    FLCTL->PRG_CTLSTAT = 0;
+}
+
+static int check_Record(const CalData * record){
+    return CAL_MAGIC == record->magic &&
+           record->check == ~(record->magic ^ (unsigned int)record->gain ^ (unsigned int)record->offset);
+}
+
+/* check_DAC()
+ *  ~XOR of every word before check
+ */
+static unsigned int check_DAC(const DacCal * record){
+    const unsigned int * words = (const unsigned int *)record;
+    unsigned int value = 0;
+    unsigned int i;
+    for(i = 0; i < sizeof(DacCal)/4 - 1; i++){
+        value ^= words[i];
+    }
+    return ~value;
+}
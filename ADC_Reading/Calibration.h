@@ -0,0 +1,87 @@
+/*
+ * Calibration.h
+ *
+ *   This libary holds ADC gain and offset and keeps them in flash
+ *      init_Calibration      - Loads saved values, nominal values if none
+ *      get_Calibration       - Returns values in use
+ *      set_Point_Calibration - Records a reading taken at a known voltage
+ *      solve_Calibration     - Finds gain and offset from the two points
+ *      save_Calibration      - Writes values in use to flash
+ *      saved_Calibration     - Returns if values in use came from flash
+ *      set_DAC_Calibration   - Sets the measured DAC transfer curve
+ *      get_DAC_Calibration   - Returns DAC curve in use, 0 if none
+ *
+ *   mV = (raw*gain + offset) >> 16, gain is mV per count and offset is mV,
+ *   both Q16. Two points are read once per board with known voltages on
+ *   the input, solved, and saved to info flash so every reading after is
+ *   one integer multiply and shift.
+ *
+ *   The DAC curve holds the output measured at every DAC_CAL_STEP codes
+ *   (Linearity.h), mV_DAC inverts it so tables built in mV come out right.
+ *
+ *   Records live in info memory bank 0 sector 0, past the boot override
+ *   mailbox at the start of the sector. The rest of info memory is the TLV
+ *   and the BSL, so there is no sector of our own. save_Calibration copies
+ *   everything below CAL_ADDRESS to RAM and programs it back after the
+ *   erase, so the mailbox survives. From CAL_ADDRESS to the end of the
+ *   sector belongs to calibration. Info memory is not erased when CCS
+ *   loads a new program so values survive reflashing. Both records share
+ *   the erase unit so save_Calibration always writes both.
+ *
+ * Depenedencies:
+ *   MSP.h -  Needed for direct register access
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *   Oct 19, 2026 - DAC transfer curve record
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef CALIBRATION_H_
+#define CALIBRATION_H_
+#include "msp.h"
+
+#define CAL_SECTOR          0x00200000  // Info bank 0 sector 0, 4 KB erase unit
+#define CAL_ADDRESS         0x00200800  // Record, clear of the mailbox
+#define CAL_KEEP_WORDS      ((CAL_ADDRESS - CAL_SECTOR)/4)  // Mailbox area kept across an erase
+#define CAL_MAGIC           0x314C4143  // "CAL1"
+#define CAL_NOMINAL_GAIN    13173       // 0.201 mV per count, Q16
+#define CAL_POINT_BITS      4           // Fraction bits in averaged point readings
+#define CAL_DAC_ADDRESS     0x00200900  // DAC curve record, same sector
+#define CAL_DAC_MAGIC       0x31434144  // "DAC1"
+#define DAC_CAL_STEP        64          // Codes between curve points
+#define DAC_CAL_POINTS      (4096/DAC_CAL_STEP + 1)     // Last point is code 4095
+#define DAC_CAL_BITS        4           // Fraction bits of curve mV
+#define DAC_CAL_CODE(i)     ((i) < DAC_CAL_POINTS - 1 ? (i)*DAC_CAL_STEP : 4095)
+
+//Data struct for stored values, layout is the flash record
+typedef struct{
+    unsigned int magic;
+    int          gain;                  // mV per count, Q16
+    int          offset;                // mV, Q16
+    unsigned int check;                 // ~(magic ^ gain ^ offset)
+}CalData;
+
+//Data struct for DAC curve, layout is the flash record
+typedef struct{
+    unsigned int   magic;
+    unsigned short mV[ DAC_CAL_POINTS ];  // Output at point i, Q DAC_CAL_BITS, non-decreasing
+    unsigned short spare;               // Pads odd point count, keeps check word aligned
+    unsigned int   check;               // ~XOR of every word before it
+}DacCal;
+
+void init_Calibration(void);
+const CalData * get_Calibration(void);
+void set_Point_Calibration(unsigned int index, unsigned int reading, int mV);
+int  solve_Calibration(void);
+int  save_Calibration(void);
+int  saved_Calibration(void);
+void set_DAC_Calibration(const unsigned short * mV);
+const DacCal * get_DAC_Calibration(void);
+
+#endif /* CALIBRATION_H_ */
@@ -0,0 +1,50 @@
+/*
+ * Cycles.h
+ *
+ *   This libary holds the DWT cycle counter for timing code on target
+ *      init_Cycles - Enables trace and starts the cycle counter
+ *      get_Cycles  - Returns the free running 32 bit cycle count
+ *
+ *   Time a section by subtracting two get_Cycles() reads, unsigned
+ *   subtraction handles one wrap (about 89 s at 48 MHz).
+ *
+ * Depenedencies:
+ *   msp.h - CoreDebug and DWT from the CMSIS core header
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *   Oct 19, 2026 - init_Cycles leaves a running count alone for shared use
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef CYCLES_H_
+#define CYCLES_H_
+#include "msp.h"
+
+/* init_Cycles()
+ *  Safe to call from every user, count is only cleared when first started
+ *  so timestamps taken by one module stay valid for another
+ */
+static inline void init_Cycles(void){
+    if(0 == (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)){
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+}
+
+/* get_Cycles()
+ *
+ * Returns:
+ *  CPU cycles since init_Cycles
+ */
+static inline unsigned int get_Cycles(void){
+    return DWT->CYCCNT;
+}
+
+#endif /* CYCLES_H_ */
@@ -0,0 +1,110 @@
+/*
+ *  DAC.c
+ *    This holds the functions for the MCP4921 DAC
+ *    See DAC.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Apr 24, 2017 - Initial Creation
+ *   Oct 19, 2026 - Split out of DAC.h, chip select waits for SPI to finish
+ *   Oct 19, 2026 - mV_DAC interpolates measured curve
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "DAC.h"
+
+/* init_DAC()
+ *  This function configures the CE pin and possibly SPI if needed
+ *
+ * Parameters:
+ *  none
+ *
+ * Errors:
+ *  None Currently - May 3, 2017
+ */
+void init_DAC(void){
+    //Setup Chip select pin
+    CE_PORT->SEL0 &= ~(CE_PIN);
+    CE_PORT->SEL1 &= ~(CE_PIN);
+    CE_PORT->DIR |= CE_PIN;
+    CE_PORT->OUT |= CE_PIN;
+
+    //Init SPI if it is not already started
+    init_SPI();
+}
+
+/* send_DAC()
+ *  This function sends a value to the DAC to output in 1x mode
+ *
+ * Parameters:
+ *  value - value for DAC, truncated to 12bit in function
+ *
+ * Errors:
+ *  None Currently - May 3, 2017
+ */
+void send_DAC(unsigned int value){
+    unsigned int DAC_Word = 0;
+    //Setup message, active mode, 1x Mode
+    DAC_Word = (0x3000)|(value & 0x0FFF);
+    //Send Chip select low, starting SPI communication
+    CE_PORT->OUT &= ~(CE_PIN);
+    //Send first byte
+    send_SPI(DAC_Word >> 8);
+    //Send second byte
+    send_SPI(DAC_Word & 0x0FF);
+    //Wait for last bit, DAC drops the word if chip select rises early
+    wait_SPI();
+    //Send Chip Select high, ending SPI communication
+    CE_PORT->OUT |=  (CE_PIN);
+}
+
+/* mV_DAC()
+ *  Converts a voltage to the nearest DAC code. With a measured curve the
+ *  segment holding mV is found by binary search and the code linearly
+ *  interpolated inside it.
+ *
+ * Parameters:
+ *  mV - Output voltage in millivolts, clamped to 0-DAC_VREF_MV
+ *
+ * Returns:
+ *  DAC code 0-DAC_MAX
+ */
+unsigned int mV_DAC(int mV){
+    const DacCal * curve = get_DAC_Calibration();
+    unsigned int target, low, high, mid, span;
+
+    if(mV <= 0){
+        return 0;
+    }
+    if(mV >= DAC_VREF_MV){
+        return DAC_MAX;
+    }
+    if(!curve){
+        return (mV*(DAC_MAX + 1) + DAC_VREF_MV/2)/DAC_VREF_MV;
+    }
+
+    target = (unsigned int)mV << DAC_CAL_BITS;
+    if(target <= curve->mV[0]){                             // Below zero scale output
+        return 0;
+    }
+    if(target >= curve->mV[DAC_CAL_POINTS - 1]){            // Past full scale output
+        return DAC_MAX;
+    }
+
+    //Find low with mV[low] < target <= mV[high], high = low + 1
+    low  = 0;
+    high = DAC_CAL_POINTS - 1;
+    while(high - low > 1){
+        mid = (low + high) >> 1;
+        if(curve->mV[mid] < target){
+            low = mid;
+        }else{
+            high = mid;
+        }
+    }
+    span = curve->mV[high] - curve->mV[low];
+    return DAC_CAL_CODE(low) +
+           ((target - curve->mV[low])*(DAC_CAL_CODE(high) - DAC_CAL_CODE(low)) + span/2)/span;
+}
@@ -0,0 +1,47 @@
+/*
+ * DAC.h
+ *
+ * This holds functions for controlling an MCP4921 DAC
+ *  init_DAC - Configures DAC pins, starts SPI if necessary
+ *  send_DAC - Sends a value to DAC to output
+ *  mV_DAC   - Converts millivolts to a DAC code, clamped to range
+ *
+ *  mV_DAC inverts the measured curve from Calibration.h when one is set,
+ *  ideal straight line otherwise. Tables are built through it once so
+ *  the correction costs nothing per sample.
+ *
+ * Dependencies:
+ *  MSP.h
+ *  SPI.h
+ *  Calibration.h
+ *
+ * Errors:
+ *  None Currently May 3, 2017
+ *
+ * Revisions:
+ *  Apr 24, 2017 - Initial Creation
+ *  May  3, 2017 - init_DAC added
+ *  May  7, 2017 - Switched to 1x mode
+ *  Oct 19, 2026 - Split into DAC.c for assignment 8, mV_DAC added
+ *  Oct 19, 2026 - mV_DAC uses measured linearity curve
+ *
+ * Authors: Drew Hartley, Jordan Jones
+ */
+
+#ifndef DAC_H_
+#define DAC_H_
+#include "SPI.h"
+#include "Calibration.h"
+
+//Change to change chip select
+#define CE_PIN  BIT4
+#define CE_PORT P9
+
+#define DAC_MAX      4095               // 12 bit code
+#define DAC_VREF_MV  3300               // Reference voltage, 1x gain so full scale
+
+void init_DAC(void);
+void send_DAC(unsigned int value);
+unsigned int mV_DAC(int mV);
+
+#endif /* DAC_H_ */
@@ -0,0 +1,47 @@
+/*
+ *  DMA.c
+ *    This holds the shared DMA control table and setup functions
+ *    See DMA.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "DMA.h"
+
+//Control base must be aligned to table size (8 channels * 2 * 16 bytes)
+#pragma DATA_ALIGN(DMA_TABLE, 256)
+DMAControl DMA_TABLE[ 2*DMA_CHANNELS ];
+
+/* init_DMA()
+ *  Enables DMA controller and points it at the control table,
+ *  setup to only be called once
+ */
+void init_DMA(void){
+    static int started = 0;
+    if(0 == started){                                       // Allow shared use by several drivers
+        DMA_Control->CFG     = DMA_CFG_MASTEN;              // Enable controller
+        DMA_Control->CTLBASE = (uint32_t)DMA_TABLE;         // Point at control table
+        started = 1;
+    }
+}
+
+/* config_Channel_DMA()
+ *  Routes a trigger source to a channel, channel left disabled
+ *
+ * Parameters:
+ *  channel - DMA channel 0-7
+ *  source  - Source select from datasheet table
+ */
+void config_Channel_DMA(unsigned int channel, unsigned int source){
+    init_DMA();
+    DMA_Control->ENACLR        = 1 << channel;              // Stop channel while changing it
+    DMA_Control->ALTCLR        = 1 << channel;              // Start on primary structure
+    DMA_Control->USEBURSTCLR   = 1 << channel;              // Allow single requests
+    DMA_Control->REQMASKCLR    = 1 << channel;              // Allow peripheral requests
+    DMA_Channel->CH_SRCCFG[channel] = source;               // Select trigger
+}
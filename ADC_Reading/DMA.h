@@ -0,0 +1,62 @@
+/*
+ * DMA.h
+ *
+ *   This libary holds the shared uDMA control table and channel setup
+ *      init_DMA           - Enables DMA controller, only runs once
+ *      config_Channel_DMA - Routes a trigger source to a channel
+ *      DMA_TABLE          - Primary and alternate control structures
+ *
+ *   Channel and source numbers come from the MSP432P401R datasheet DMA
+ *   source table, e.g. channel 0 source 1 is eUSCI_A0 TX.
+ *
+ * Depenedencies:
+ *   MSP.h -  Needed for direct register access
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef DMA_H_
+#define DMA_H_
+#include "msp.h"
+
+#define DMA_CHANNELS          8
+#define DMA_MAX_TRANSFERS     1024      // Largest N for one DMA cycle
+
+//Control word fields, see uDMA channel control word in technical reference
+#define DMA_CW_DST_INC_BYTE   (0u << 30)
+#define DMA_CW_DST_INC_HALF   (1u << 30)
+#define DMA_CW_DST_INC_NONE   (3u << 30)
+#define DMA_CW_DST_SIZE_BYTE  (0u << 28)
+#define DMA_CW_DST_SIZE_HALF  (1u << 28)
+#define DMA_CW_SRC_INC_BYTE   (0u << 26)
+#define DMA_CW_SRC_INC_HALF   (1u << 26)
+#define DMA_CW_SRC_INC_NONE   (3u << 26)
+#define DMA_CW_SRC_SIZE_BYTE  (0u << 24)
+#define DMA_CW_SRC_SIZE_HALF  (1u << 24)
+#define DMA_CW_ARB_1          (0u << 14)
+#define DMA_CW_N(n)           ((((n) - 1u) & 0x3FFu) << 4)
+#define DMA_CW_MODE_BASIC     1u
+#define DMA_CW_MODE_PINGPONG  3u
+
+//One control structure, layout fixed by the DMA controller
+typedef struct{
+    volatile void *   srcEnd;           // Address of last source item
+    volatile void *   dstEnd;           // Address of last destination item
+    volatile uint32_t control;          // Channel control word
+    volatile uint32_t spare;
+}DMAControl;
+
+//Primary structures [0..7] then alternate structures [8..15]
+extern DMAControl DMA_TABLE[ 2*DMA_CHANNELS ];
+
+void init_DMA(void);
+void config_Channel_DMA(unsigned int channel, unsigned int source);
+
+#endif /* DMA_H_ */
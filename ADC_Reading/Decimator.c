@@ -0,0 +1,76 @@
+/*
+ *  Decimator.c
+ *    This holds the boxcar decimator
+ *    See Decimator.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Decimator.h"
+
+/* init_Decimator()
+ *
+ * Parameters:
+ *  stage - Decimator to set up
+ *  k     - Oversampling exponent, 0 (pass through) to DECIMATE_MAX_K
+ *
+ * Returns:
+ *  0  - No Error
+ *  -1 - k too large, stage unchanged
+ */
+int init_Decimator(Decimator * stage, unsigned int k){
+    if(DECIMATE_MAX_K < k){
+        return -1;
+    }
+    stage->k      = k;
+    stage->length = 1u << (2*k);
+    stage->count  = 0;
+    stage->sum    = 0;
+    return 0;
+}
+
+/* run_Decimator()
+ *  Sums samples and dumps one output each time 4^k have been added
+ *
+ * Parameters:
+ *  stage    - Decimator state, kept between calls
+ *  samples  - Raw samples
+ *  count    - Number of raw samples
+ *  outputs  - Room for count/4^k + 1 outputs
+ *
+ * Returns:
+ *  Number of outputs written
+ */
+unsigned int run_Decimator(Decimator * stage, const unsigned short * samples,
+                           unsigned int count, unsigned int * outputs){
+    unsigned int written = 0;
+    unsigned int sum = stage->sum;
+    unsigned int left = stage->length - stage->count;       // Samples until next dump
+
+    while(count >= left){                                   // Whole runs, no per sample test
+        unsigned int i;
+        for(i = 0; i < left; i++){
+            sum += samples[i];
+        }
+        samples += left;
+        count   -= left;
+        outputs[written++] = sum >> stage->k;
+        sum  = 0;
+        left = stage->length;
+    }
+    stage->count = stage->length - left + count;            // Partial run carries to next call
+    while(count--){
+        sum += *samples++;
+    }
+    stage->sum   = sum;
+    return written;
+}
+
+unsigned int bits_Decimator(const Decimator * stage){
+    return DECIMATE_RAW_BITS + stage->k;
+}
@@ -0,0 +1,47 @@
+/*
+ * Decimator.h
+ *
+ *   This libary holds a boxcar accumulate and dump decimator for ADC blocks
+ *      init_Decimator - Sets oversampling to 4^k and clears state
+ *      run_Decimator  - Feeds raw samples, returns decimated outputs
+ *      bits_Decimator - Returns bits in each output
+ *
+ *   Each output is the sum of 4^k raw samples shifted right by k, so white
+ *   noise averages out to k extra bits (14+k bit outputs). Sums carry over
+ *   between calls so blocks need not be a multiple of 4^k. Integer adds
+ *   and one shift per output, well inside the time per sample at
+ *   ADC_MAX_RATE.
+ *
+ * Depenedencies:
+ *   None
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef DECIMATOR_H_
+#define DECIMATOR_H_
+
+#define DECIMATE_MAX_K      6           // 4096 samples, sum of 14 bit samples fits 32 bits
+#define DECIMATE_RAW_BITS   14
+
+//Data struct for one decimation stage
+typedef struct{
+    unsigned int k;                     // Oversampling is 4^k
+    unsigned int length;                // 4^k
+    unsigned int count;                 // Samples in current sum
+    unsigned int sum;
+}Decimator;
+
+int  init_Decimator(Decimator * stage, unsigned int k);
+unsigned int run_Decimator(Decimator * stage, const unsigned short * samples,
+                           unsigned int count, unsigned int * outputs);
+unsigned int bits_Decimator(const Decimator * stage);
+
+#endif /* DECIMATOR_H_ */
@@ -0,0 +1,111 @@
+/*
+ *  FFT.c
+ *    This holds the Q15 FFT
+ *    See FFT.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *   Oct 19, 2026 - Magnitude root from Fixed_Math
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "FFT.h"
+#include "Fixed_Math.h"
+
+#define SAMPLE_MID      8192            // Mid scale of a 14 bit sample
+
+/* window_FFT()
+ *  Removes the block mean, scales to Q15 and applies the Hann window
+ *
+ * Parameters:
+ *  samples - FFT_SIZE raw 14 bit ADC samples
+ *  re      - FFT_SIZE real outputs
+ *  im      - FFT_SIZE imaginary outputs, cleared
+ */
+void window_FFT(const unsigned short * samples, short * re, short * im){
+    unsigned int i;
+    unsigned int sum = 0;
+    int mean;
+
+    for(i = 0; i < FFT_SIZE; i++){
+        sum += samples[ i ];
+    }
+    mean = (int)(sum >> FFT_BITS);
+
+    for(i = 0; i < FFT_SIZE; i++){
+        int x = ((int)samples[ i ] - mean) << 1;    // 14 bit swing to Q15
+        int w = FFT_WINDOW[ (i <= FFT_SIZE/2) ? i : FFT_SIZE - i ];
+        if(x >  32767) x =  32767;                  // Only a rail to rail block with a mean off
+        if(x < -32768) x = -32768;                  // center can reach this
+        re[ i ] = (short)((x * w) >> 15);
+        im[ i ] = 0;
+    }
+}
+
+/* run_FFT()
+ *  Bit reverses then runs FFT_BITS butterfly stages, each scaled by 1/2
+ *
+ * Parameters:
+ *  re - FFT_SIZE real values, replaced with the spectrum / FFT_SIZE
+ *  im - FFT_SIZE imaginary values, replaced likewise
+ */
+void run_FFT(short * re, short * im){
+    unsigned int i, j, k;
+    unsigned int half, step, span;
+
+    //Bit reversal permutation
+    j = 0;
+    for(i = 0; i < FFT_SIZE - 1; i++){
+        if(i < j){
+            short t;
+            t = re[ i ]; re[ i ] = re[ j ]; re[ j ] = t;
+            t = im[ i ]; im[ i ] = im[ j ]; im[ j ] = t;
+        }
+        k = FFT_SIZE >> 1;
+        while(k <= j){
+            j -= k;
+            k >>= 1;
+        }
+        j += k;
+    }
+
+    //Butterflies, W = cos - j*sin so (a + jb)W = (a*cos + b*sin) + j(b*cos - a*sin)
+    step = FFT_SIZE >> 1;
+    for(half = 1; half < FFT_SIZE; half <<= 1){
+        span = half << 1;
+        for(j = 0; j < half; j++){
+            int c = FFT_TWIDDLE[ 2*j*step ];
+            int s = FFT_TWIDDLE[ 2*j*step + 1 ];
+            for(i = j; i < FFT_SIZE; i += span){
+                unsigned int m = i + half;
+                int tr = ((int)re[ m ]*c + (int)im[ m ]*s) >> 15;
+                int ti = ((int)im[ m ]*c - (int)re[ m ]*s) >> 15;
+                int ur = re[ i ];
+                int ui = im[ i ];
+                re[ i ] = (short)((ur + tr) >> 1);
+                im[ i ] = (short)((ui + ti) >> 1);
+                re[ m ] = (short)((ur - tr) >> 1);
+                im[ m ] = (short)((ui - ti) >> 1);
+            }
+        }
+        step >>= 1;
+    }
+}
+
+/* magnitude_FFT()
+ *  Integer square root of re^2 + im^2 for bins 0 to FFT_BINS-1
+ *
+ * Parameters:
+ *  re, im - Spectrum from run_FFT
+ *  bins   - FFT_BINS magnitudes
+ */
+void magnitude_FFT(const short * re, const short * im, unsigned short * bins){
+    unsigned int i;
+    for(i = 0; i < FFT_BINS; i++){
+        unsigned int value = (unsigned int)((int)re[ i ]*re[ i ] + (int)im[ i ]*im[ i ]);
+        bins[ i ] = (unsigned short)sqrt_Fixed(value);
+    }
+}
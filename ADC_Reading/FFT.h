@@ -0,0 +1,44 @@
+/*
+ * FFT.h
+ *
+ *   This libary holds a Q15 fixed point FFT for spectra of ADC captures
+ *      window_FFT    - Removes DC, scales 14 bit samples to Q15, applies Hann window
+ *      run_FFT       - In place radix 2 decimation in time FFT
+ *      magnitude_FFT - Converts the first FFT_SIZE/2 bins to magnitudes
+ *
+ *   Each of the FFT_BITS stages halves its outputs so no butterfly can
+ *   overflow, the result is the DFT divided by FFT_SIZE. A full scale sine
+ *   lands at about 4096 in its bin (half its Q15 amplitude, times the
+ *   window gain of 1/2). Twiddle and window tables are const in flash
+ *   (FFT_Tables.c), regenerate them with Host_Tools/gen_fft_tables.py
+ *   after changing FFT_BITS.
+ *
+ * Depenedencies:
+ *   Fixed_Math.h - Integer square root for magnitudes
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *   Oct 19, 2026 - Uses Fixed_Math
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef FFT_H_
+#define FFT_H_
+
+#define FFT_BITS        10
+#define FFT_SIZE        (1u << FFT_BITS)    // 1024 points
+#define FFT_BINS        (FFT_SIZE/2)        // Bins 0 to Nyquist-1
+
+extern const short FFT_TWIDDLE[ FFT_SIZE ];     // FFT_SIZE/2 pairs of cos, sin
+extern const short FFT_WINDOW[ FFT_SIZE/2 + 1 ];
+
+void window_FFT(const unsigned short * samples, short * re, short * im);
+void run_FFT(short * re, short * im);
+void magnitude_FFT(const short * re, const short * im, unsigned short * bins);
+
+#endif /* FFT_H_ */
@@ -0,0 +1,209 @@
+/*
+ *  FFT_Tables.c
+ *    Q15 tables for FFT.c, generated by Host_Tools/gen_fft_tables.py 10
+ *    Do not edit, rerun the script instead
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "FFT.h"
+
+//Twiddle factors W^k = cos - j*sin for k = 0 to FFT_SIZE/2-1, pairs of cos, sin
+const short FFT_TWIDDLE[ 1024 ] = {
+     32767,      0,  32767,    201,  32766,    402,  32762,    603,
+     32758,    804,  32753,   1005,  32746,   1206,  32738,   1407,
+     32729,   1608,  32718,   1809,  32706,   2009,  32693,   2210,
+     32679,   2411,  32664,   2611,  32647,   2811,  32629,   3012,
+     32610,   3212,  32590,   3412,  32568,   3612,  32546,   3812,
+     32522,   4011,  32496,   4211,  32470,   4410,  32442,   4609,
+     32413,   4808,  32383,   5007,  32352,   5205,  32319,   5404,
+     32286,   5602,  32251,   5800,  32214,   5998,  32177,   6195,
+     32138,   6393,  32099,   6590,  32058,   6787,  32015,   6983,
+     31972,   7180,  31927,   7376,  31881,   7571,  31834,   7767,
+     31786,   7962,  31737,   8157,  31686,   8351,  31634,   8546,
+     31581,   8740,  31527,   8933,  31471,   9127,  31415,   9319,
+     31357,   9512,  31298,   9704,  31238,   9896,  31177,  10088,
+     31114,  10279,  31050,  10469,  30986,  10660,  30920,  10850,
+     30853,  11039,  30784,  11228,  30715,  11417,  30644,  11605,
+     30572,  11793,  30499,  11980,  30425,  12167,  30350,  12354,
+     30274,  12540,  30196,  12725,  30118,  12910,  30038,  13095,
+     29957,  13279,  29875,  13463,  29792,  13646,  29707,  13828,
+     29622,  14010,  29535,  14192,  29448,  14373,  29359,  14553,
+     29269,  14733,  29178,  14912,  29086,  15091,  28993,  15269,
+     28899,  15447,  28803,  15624,  28707,  15800,  28610,  15976,
+     28511,  16151,  28411,  16326,  28311,  16500,  28209,  16673,
+     28106,  16846,  28002,  17018,  27897,  17190,  27791,  17361,
+     27684,  17531,  27576,  17700,  27467,  17869,  27357,  18037,
+     27246,  18205,  27133,  18372,  27020,  18538,  26906,  18703,
+     26791,  18868,  26674,  19032,  26557,  19195,  26439,  19358,
+     26320,  19520,  26199,  19681,  26078,  19841,  25956,  20001,
+     25833,  20160,  25708,  20318,  25583,  20475,  25457,  20632,
+     25330,  20788,  25202,  20943,  25073,  21097,  24943,  21251,
+     24812,  21403,  24680,  21555,  24548,  21706,  24414,  21856,
+     24279,  22006,  24144,  22154,  24008,  22302,  23870,  22449,
+     23732,  22595,  23593,  22740,  23453,  22884,  23312,  23028,
+     23170,  23170,  23028,  23312,  22884,  23453,  22740,  23593,
+     22595,  23732,  22449,  23870,  22302,  24008,  22154,  24144,
+     22006,  24279,  21856,  24414,  21706,  24548,  21555,  24680,
+     21403,  24812,  21251,  24943,  21097,  25073,  20943,  25202,
+     20788,  25330,  20632,  25457,  20475,  25583,  20318,  25708,
+     20160,  25833,  20001,  25956,  19841,  26078,  19681,  26199,
+     19520,  26320,  19358,  26439,  19195,  26557,  19032,  26674,
+     18868,  26791,  18703,  26906,  18538,  27020,  18372,  27133,
+     18205,  27246,  18037,  27357,  17869,  27467,  17700,  27576,
+     17531,  27684,  17361,  27791,  17190,  27897,  17018,  28002,
+     16846,  28106,  16673,  28209,  16500,  28311,  16326,  28411,
+     16151,  28511,  15976,  28610,  15800,  28707,  15624,  28803,
+     15447,  28899,  15269,  28993,  15091,  29086,  14912,  29178,
+     14733,  29269,  14553,  29359,  14373,  29448,  14192,  29535,
+     14010,  29622,  13828,  29707,  13646,  29792,  13463,  29875,
+     13279,  29957,  13095,  30038,  12910,  30118,  12725,  30196,
+     12540,  30274,  12354,  30350,  12167,  30425,  11980,  30499,
+     11793,  30572,  11605,  30644,  11417,  30715,  11228,  30784,
+     11039,  30853,  10850,  30920,  10660,  30986,  10469,  31050,
+     10279,  31114,  10088,  31177,   9896,  31238,   9704,  31298,
+      9512,  31357,   9319,  31415,   9127,  31471,   8933,  31527,
+      8740,  31581,   8546,  31634,   8351,  31686,   8157,  31737,
+      7962,  31786,   7767,  31834,   7571,  31881,   7376,  31927,
+      7180,  31972,   6983,  32015,   6787,  32058,   6590,  32099,
+      6393,  32138,   6195,  32177,   5998,  32214,   5800,  32251,
+      5602,  32286,   5404,  32319,   5205,  32352,   5007,  32383,
+      4808,  32413,   4609,  32442,   4410,  32470,   4211,  32496,
+      4011,  32522,   3812,  32546,   3612,  32568,   3412,  32590,
+      3212,  32610,   3012,  32629,   2811,  32647,   2611,  32664,
+      2411,  32679,   2210,  32693,   2009,  32706,   1809,  32718,
+      1608,  32729,   1407,  32738,   1206,  32746,   1005,  32753,
+       804,  32758,    603,  32762,    402,  32766,    201,  32767,
+         0,  32767,   -201,  32767,   -402,  32766,   -603,  32762,
+      -804,  32758,  -1005,  32753,  -1206,  32746,  -1407,  32738,
+     -1608,  32729,  -1809,  32718,  -2009,  32706,  -2210,  32693,
+     -2411,  32679,  -2611,  32664,  -2811,  32647,  -3012,  32629,
+     -3212,  32610,  -3412,  32590,  -3612,  32568,  -3812,  32546,
+     -4011,  32522,  -4211,  32496,  -4410,  32470,  -4609,  32442,
+     -4808,  32413,  -5007,  32383,  -5205,  32352,  -5404,  32319,
+     -5602,  32286,  -5800,  32251,  -5998,  32214,  -6195,  32177,
+     -6393,  32138,  -6590,  32099,  -6787,  32058,  -6983,  32015,
+     -7180,  31972,  -7376,  31927,  -7571,  31881,  -7767,  31834,
+     -7962,  31786,  -8157,  31737,  -8351,  31686,  -8546,  31634,
+     -8740,  31581,  -8933,  31527,  -9127,  31471,  -9319,  31415,
+     -9512,  31357,  -9704,  31298,  -9896,  31238, -10088,  31177,
+    -10279,  31114, -10469,  31050, -10660,  30986, -10850,  30920,
+    -11039,  30853, -11228,  30784, -11417,  30715, -11605,  30644,
+    -11793,  30572, -11980,  30499, -12167,  30425, -12354,  30350,
+    -12540,  30274, -12725,  30196, -12910,  30118, -13095,  30038,
+    -13279,  29957, -13463,  29875, -13646,  29792, -13828,  29707,
+    -14010,  29622, -14192,  29535, -14373,  29448, -14553,  29359,
+    -14733,  29269, -14912,  29178, -15091,  29086, -15269,  28993,
+    -15447,  28899, -15624,  28803, -15800,  28707, -15976,  28610,
+    -16151,  28511, -16326,  28411, -16500,  28311, -16673,  28209,
+    -16846,  28106, -17018,  28002, -17190,  27897, -17361,  27791,
+    -17531,  27684, -17700,  27576, -17869,  27467, -18037,  27357,
+    -18205,  27246, -18372,  27133, -18538,  27020, -18703,  26906,
+    -18868,  26791, -19032,  26674, -19195,  26557, -19358,  26439,
+    -19520,  26320, -19681,  26199, -19841,  26078, -20001,  25956,
+    -20160,  25833, -20318,  25708, -20475,  25583, -20632,  25457,
+    -20788,  25330, -20943,  25202, -21097,  25073, -21251,  24943,
+    -21403,  24812, -21555,  24680, -21706,  24548, -21856,  24414,
+    -22006,  24279, -22154,  24144, -22302,  24008, -22449,  23870,
+    -22595,  23732, -22740,  23593, -22884,  23453, -23028,  23312,
+    -23170,  23170, -23312,  23028, -23453,  22884, -23593,  22740,
+    -23732,  22595, -23870,  22449, -24008,  22302, -24144,  22154,
+    -24279,  22006, -24414,  21856, -24548,  21706, -24680,  21555,
+    -24812,  21403, -24943,  21251, -25073,  21097, -25202,  20943,
+    -25330,  20788, -25457,  20632, -25583,  20475, -25708,  20318,
+    -25833,  20160, -25956,  20001, -26078,  19841, -26199,  19681,
+    -26320,  19520, -26439,  19358, -26557,  19195, -26674,  19032,
+    -26791,  18868, -26906,  18703, -27020,  18538, -27133,  18372,
+    -27246,  18205, -27357,  18037, -27467,  17869, -27576,  17700,
+    -27684,  17531, -27791,  17361, -27897,  17190, -28002,  17018,
+    -28106,  16846, -28209,  16673, -28311,  16500, -28411,  16326,
+    -28511,  16151, -28610,  15976, -28707,  15800, -28803,  15624,
+    -28899,  15447, -28993,  15269, -29086,  15091, -29178,  14912,
+    -29269,  14733, -29359,  14553, -29448,  14373, -29535,  14192,
+    -29622,  14010, -29707,  13828, -29792,  13646, -29875,  13463,
+    -29957,  13279, -30038,  13095, -30118,  12910, -30196,  12725,
+    -30274,  12540, -30350,  12354, -30425,  12167, -30499,  11980,
+    -30572,  11793, -30644,  11605, -30715,  11417, -30784,  11228,
+    -30853,  11039, -30920,  10850, -30986,  10660, -31050,  10469,
+    -31114,  10279, -31177,  10088, -31238,   9896, -31298,   9704,
+    -31357,   9512, -31415,   9319, -31471,   9127, -31527,   8933,
+    -31581,   8740, -31634,   8546, -31686,   8351, -31737,   8157,
+    -31786,   7962, -31834,   7767, -31881,   7571, -31927,   7376,
+    -31972,   7180, -32015,   6983, -32058,   6787, -32099,   6590,
+    -32138,   6393, -32177,   6195, -32214,   5998, -32251,   5800,
+    -32286,   5602, -32319,   5404, -32352,   5205, -32383,   5007,
+    -32413,   4808, -32442,   4609, -32470,   4410, -32496,   4211,
+    -32522,   4011, -32546,   3812, -32568,   3612, -32590,   3412,
+    -32610,   3212, -32629,   3012, -32647,   2811, -32664,   2611,
+    -32679,   2411, -32693,   2210, -32706,   2009, -32718,   1809,
+    -32729,   1608, -32738,   1407, -32746,   1206, -32753,   1005,
+    -32758,    804, -32762,    603, -32766,    402, -32767,    201
+};
+
+//Periodic Hann window, first half, w[FFT_SIZE-i] = w[i]
+const short FFT_WINDOW[ 513 ] = {
+         0,      0,      1,      3,      5,      8,     11,     15,
+        20,     25,     31,     37,     44,     52,     60,     69,
+        79,     89,    100,    111,    123,    136,    149,    163,
+       177,    192,    208,    224,    241,    259,    277,    296,
+       315,    335,    355,    376,    398,    420,    443,    467,
+       491,    516,    541,    567,    593,    621,    648,    677,
+       705,    735,    765,    796,    827,    859,    891,    924,
+       958,    992,   1027,   1062,   1098,   1134,   1171,   1209,
+      1247,   1286,   1325,   1365,   1406,   1447,   1488,   1530,
+      1573,   1616,   1660,   1704,   1749,   1795,   1841,   1887,
+      1935,   1982,   2030,   2079,   2128,   2178,   2229,   2280,
+      2331,   2383,   2435,   2488,   2542,   2596,   2651,   2706,
+      2761,   2817,   2874,   2931,   2989,   3047,   3105,   3165,
+      3224,   3284,   3345,   3406,   3468,   3530,   3592,   3655,
+      3719,   3783,   3847,   3912,   3978,   4044,   4110,   4177,
+      4244,   4312,   4380,   4449,   4518,   4587,   4657,   4728,
+      4799,   4870,   4942,   5014,   5087,   5160,   5233,   5307,
+      5381,   5456,   5531,   5606,   5682,   5759,   5835,   5913,
+      5990,   6068,   6146,   6225,   6304,   6383,   6463,   6543,
+      6624,   6705,   6786,   6868,   6950,   7032,   7115,   7198,
+      7282,   7365,   7449,   7534,   7619,   7704,   7789,   7875,
+      7961,   8047,   8134,   8221,   8308,   8396,   8484,   8572,
+      8661,   8749,   8839,   8928,   9018,   9108,   9198,   9288,
+      9379,   9470,   9561,   9653,   9745,   9837,   9929,  10021,
+     10114,  10207,  10300,  10394,  10487,  10581,  10676,  10770,
+     10864,  10959,  11054,  11149,  11245,  11340,  11436,  11532,
+     11628,  11724,  11821,  11917,  12014,  12111,  12208,  12306,
+     12403,  12501,  12598,  12696,  12794,  12892,  12991,  13089,
+     13188,  13286,  13385,  13484,  13583,  13682,  13781,  13881,
+     13980,  14079,  14179,  14279,  14378,  14478,  14578,  14678,
+     14778,  14878,  14978,  15078,  15179,  15279,  15379,  15480,
+     15580,  15680,  15781,  15881,  15982,  16082,  16183,  16283,
+     16384,  16485,  16585,  16686,  16786,  16887,  16987,  17088,
+     17188,  17288,  17389,  17489,  17589,  17690,  17790,  17890,
+     17990,  18090,  18190,  18290,  18390,  18489,  18589,  18689,
+     18788,  18887,  18987,  19086,  19185,  19284,  19383,  19482,
+     19580,  19679,  19777,  19876,  19974,  20072,  20170,  20267,
+     20365,  20462,  20560,  20657,  20754,  20851,  20947,  21044,
+     21140,  21236,  21332,  21428,  21523,  21619,  21714,  21809,
+     21904,  21998,  22092,  22187,  22281,  22374,  22468,  22561,
+     22654,  22747,  22839,  22931,  23023,  23115,  23207,  23298,
+     23389,  23480,  23570,  23660,  23750,  23840,  23929,  24019,
+     24107,  24196,  24284,  24372,  24460,  24547,  24634,  24721,
+     24807,  24893,  24979,  25064,  25149,  25234,  25319,  25403,
+     25486,  25570,  25653,  25736,  25818,  25900,  25982,  26063,
+     26144,  26225,  26305,  26385,  26464,  26543,  26622,  26700,
+     26778,  26855,  26933,  27009,  27086,  27162,  27237,  27312,
+     27387,  27461,  27535,  27608,  27681,  27754,  27826,  27898,
+     27969,  28040,  28111,  28181,  28250,  28319,  28388,  28456,
+     28524,  28591,  28658,  28724,  28790,  28856,  28921,  28985,
+     29049,  29113,  29176,  29238,  29300,  29362,  29423,  29484,
+     29544,  29603,  29663,  29721,  29779,  29837,  29894,  29951,
+     30007,  30062,  30117,  30172,  30226,  30280,  30333,  30385,
+     30437,  30488,  30539,  30590,  30640,  30689,  30738,  30786,
+     30833,  30881,  30927,  30973,  31019,  31064,  31108,  31152,
+     31195,  31238,  31280,  31321,  31362,  31403,  31443,  31482,
+     31521,  31559,  31597,  31634,  31670,  31706,  31741,  31776,
+     31810,  31844,  31877,  31909,  31941,  31972,  32003,  32033,
+     32063,  32091,  32120,  32147,  32175,  32201,  32227,  32252,
+     32277,  32301,  32325,  32348,  32370,  32392,  32413,  32433,
+     32453,  32472,  32491,  32509,  32527,  32544,  32560,  32576,
+     32591,  32605,  32619,  32632,  32645,  32657,  32668,  32679,
+     32689,  32699,  32708,  32716,  32724,  32731,  32737,  32743,
+     32748,  32753,  32757,  32760,  32763,  32765,  32767,  32767,
+     32767
+};
@@ -0,0 +1,141 @@
+/*
+ *  Filter.c
+ *    This holds the FIR and biquad filters and their coefficient sets
+ *    See Filter.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Filter.h"
+#include <string.h>
+
+#if FILTER_MAX_COEFS < 5*FILTER_MAX_SECTIONS
+#error "FILTER_MAX_COEFS must hold every biquad section"
+#endif
+
+//Data struct for one coefficient set
+typedef struct{
+    FilterType   type;
+    unsigned int count;                 // Taps or sections
+    short        coef[ FILTER_MAX_COEFS ];
+}FilterSet;
+
+static FilterSet SETS[2] = {{pass, 0, {0}}, {pass, 0, {0}}};
+static const FilterSet * volatile activeSet = &SETS[0];    // ISR reads, apply_Filter swaps
+static const FilterSet * lastSet = &SETS[0];                // Set the state below belongs to
+
+//Filter state, ISR only
+static short history[ 2*FILTER_MAX_TAPS ];                  // Each sample stored twice, no wrap in sum
+static unsigned int position;
+static int sectionState[ FILTER_MAX_SECTIONS ][4];          // x1, x2, y1, y2
+
+static FilterSet * staged_Set(void);
+
+/* load_Filter()
+ *
+ * Parameters:
+ *  index - Coefficient number, taps in order or b0 b1 b2 a1 a2 per section
+ *  value - Q15 tap or Q14 biquad coefficient
+ *
+ * Returns:
+ *  0  - Stored, takes effect on apply_Filter
+ *  -1 - Index or value out of range
+ */
+int load_Filter(unsigned int index, int value){
+    if(FILTER_MAX_COEFS <= index || -32768 > value || 32767 < value){
+        return -1;
+    }
+    staged_Set()->coef[index] = (short)value;
+    return 0;
+}
+
+/* apply_Filter()
+ *  Swaps the staged coefficients in, then stages a copy of them
+ *
+ * Parameters:
+ *  type  - pass, fir or biquad
+ *  count - Taps (1 to FILTER_MAX_TAPS) or sections (1 to FILTER_MAX_SECTIONS),
+ *          ignored for pass
+ *
+ * Returns:
+ *  0  - In use
+ *  -1 - Count out of range, nothing changed
+ */
+int apply_Filter(FilterType type, unsigned int count){
+    FilterSet * set = staged_Set();
+    if((fir == type && (0 == count || FILTER_MAX_TAPS < count)) ||
+       (biquad == type && (0 == count || FILTER_MAX_SECTIONS < count)) ||
+       type > biquad){
+        return -1;
+    }
+    set->type  = type;
+    set->count = (pass == type) ? 0 : count;
+    activeSet  = set;                                       // Single store, ISR sees old or new
+    *staged_Set() = *set;                                   // ISR is done with the old set
+    return 0;
+}
+
+void get_Filter(FilterType * type, unsigned int * count){
+    *type  = activeSet->type;
+    *count = activeSet->count;
+}
+
+/* run_Filter()
+ *
+ * Parameters:
+ *  sample - Signed input, 14 bit range
+ *
+ * Returns:
+ *  Filtered sample, caller clamps to its output range
+ */
+int run_Filter(int sample){
+    const FilterSet * set = activeSet;
+    unsigned int i;
+
+    if(set != lastSet){                                     // New set, old state means nothing
+        memset(history, 0, sizeof(history));
+        memset(sectionState, 0, sizeof(sectionState));
+        position = 0;
+        lastSet  = set;
+    }
+
+    if(fir == set->type){
+        long long sum = 0;
+        position = position ? position - 1 : set->count - 1;
+        history[position] = history[position + set->count] = (short)sample;
+        for(i = 0; i < set->count; i++){                    // history[position + k] is x[n-k]
+            sum += (int)set->coef[i]*history[position + i];
+        }
+        return (int)(sum >> FILTER_FIR_SHIFT);
+    }
+
+    if(biquad == set->type){
+        for(i = 0; i < set->count; i++){
+            const short * c = &set->coef[5*i];
+            int * s = sectionState[i];
+            long long sum = (long long)c[0]*sample + (long long)c[1]*s[0] + (long long)c[2]*s[1]
+                          - (long long)c[3]*s[2] - (long long)c[4]*s[3];
+            int y = (int)(sum >> FILTER_IIR_SHIFT);
+            if(y >  32767) y =  32767;
+            if(y < -32768) y = -32768;
+            s[1] = s[0];
+            s[0] = sample;
+            s[3] = s[2];
+            s[2] = y;
+            sample = y;                                     // Input to next section
+        }
+    }
+    return sample;
+}
+
+/* staged_Set()
+ *  The set run_Filter is not using
+ */
+static FilterSet * staged_Set(void){
+    return (activeSet == &SETS[0]) ? &SETS[1] : &SETS[0];
+}
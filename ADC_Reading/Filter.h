@@ -0,0 +1,57 @@
+/*
+ * Filter.h
+ *
+ *   This libary holds FIR and biquad IIR filters for sample by sample use
+ *      load_Filter  - Writes one coefficient into the staged set
+ *      apply_Filter - Swaps the staged set in as FIR, biquad or pass through
+ *      get_Filter   - Returns type and length of the set in use
+ *      run_Filter   - Filters one sample, called from the sample ISR
+ *
+ *   Coefficients are loaded into a staged copy while run_Filter uses the
+ *   other, apply_Filter swaps them with one pointer store so the ISR never
+ *   sees a half loaded set. Staged starts as a copy of the set in use so
+ *   single coefficients can be changed. Filter state is cleared on a swap.
+ *
+ *   FIR:    count taps, Q15, y = sum h[k]*x[n-k]
+ *   Biquad: count sections of b0 b1 b2 a1 a2, Q14 so |a1| < 2 fits,
+ *           a0 is 1 and a terms are subtracted. Direct form I, each
+ *           section feeds the next.
+ *   Samples are signed, 14 bit range in and out. Accumulation is 64 bit,
+ *   biquad outputs are clamped to 16 bits so an unstable set cannot run
+ *   away.
+ *
+ * Depenedencies:
+ *   None
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef FILTER_H_
+#define FILTER_H_
+
+#define FILTER_MAX_TAPS     32
+#define FILTER_MAX_SECTIONS 4
+#define FILTER_MAX_COEFS    FILTER_MAX_TAPS         // At least 5*FILTER_MAX_SECTIONS
+#define FILTER_FIR_SHIFT    15
+#define FILTER_IIR_SHIFT    14
+
+//Filter types
+typedef enum{
+    pass,                               // Output is input
+    fir,
+    biquad
+}FilterType;
+
+int  load_Filter(unsigned int index, int value);
+int  apply_Filter(FilterType type, unsigned int count);
+void get_Filter(FilterType * type, unsigned int * count);
+int  run_Filter(int sample);
+
+#endif /* FILTER_H_ */
@@ -0,0 +1,168 @@
+/*
+ *  Function_Generator.c
+ *    This holds the waveform tables and sample ISR
+ *    See Function_Generator.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *   Oct 19, 2026 - sync_Generator and phase_Generator
+ *   Oct 19, 2026 - Sine table from sin_Fixed
+ *   Oct 19, 2026 - Profile probe in sample ISR
+ *   Oct 19, 2026 - Trace mark on sample ISR
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Function_Generator.h"
+#include "Fixed_Math.h"
+#include "Profile.h"
+#include "Trace.h"
+
+static unsigned short WAVE_TABLE[2][ GEN_TABLE_LENGTH ];    // ISR reads one while other is built
+static const unsigned short * volatile activeTable = WAVE_TABLE[0];
+static volatile unsigned int phaseStep;                     // Phase added per sample, 2^32 = 1 period
+static unsigned int phase;
+static WaveData currentWave = {sine, 100, 50, 2000, 1650};
+
+static void build_Table(const WaveData * wave, unsigned short * table);
+
+void init_Generator(void){
+    init_DAC();
+    build_Table(&currentWave, WAVE_TABLE[0]);
+    activeTable = WAVE_TABLE[0];
+    phaseStep = (unsigned int)(((unsigned long long)currentWave.freq << 32)/GEN_SAMPLE_RATE);
+    send_DAC(mV_DAC(currentWave.offset));                   // Idle at DC offset
+
+    TIMER_A1->CCR[0] = GEN_TIMER_CLOCK/GEN_SAMPLE_RATE - 1; // Sample period
+    TIMER_A1->CTL    = TIMER_A_CTL_SSEL__SMCLK |            // SMCLK source
+                       TIMER_A_CTL_MC__UP      |            // Up to CCR0
+                       TIMER_A_CTL_CLR;
+    NVIC->ISER[0] = 1 << ((TA1_0_IRQn) & 31);
+}
+
+/* set_Wave_Generator()
+ *  Builds table for a waveform in the unused buffer and swaps it in
+ *
+ * Parameters:
+ *  wave - Waveform to output
+ *
+ * Returns:
+ *  0  - Waveform in use
+ *  -1 - Frequency, duty, amplitude or offset out of range, nothing changed
+ */
+int set_Wave_Generator(const WaveData * wave){
+    unsigned short * table;
+    if(0 == wave->freq || GEN_MAX_FREQ < wave->freq ||
+       0 == wave->duty || 99 < wave->duty ||
+       DAC_VREF_MV < wave->offset ||
+       DAC_VREF_MV < wave->amplitude ||
+       wave->form > triangle){
+        return -1;
+    }
+    table = (activeTable == WAVE_TABLE[0]) ? WAVE_TABLE[1] : WAVE_TABLE[0];
+    build_Table(wave, table);                               // Parts past the rails are clipped
+    activeTable = table;                                    // Single store, ISR sees old or new
+    phaseStep   = (unsigned int)(((unsigned long long)wave->freq << 32)/GEN_SAMPLE_RATE);
+    currentWave = *wave;
+    if(!running_Generator()){
+        send_DAC(mV_DAC(currentWave.offset));               // Track new offset while idle
+    }
+    return 0;
+}
+
+void get_Wave_Generator(WaveData * wave){
+    *wave = currentWave;
+}
+
+void output_Generator(int on){
+    if(on){
+        TIMER_A1->CCTL[0] &= ~TIMER_A_CCTLN_CCIFG;
+        TIMER_A1->CCTL[0] |=  TIMER_A_CCTLN_CCIE;           // Start sample interrupt
+    }else{
+        TIMER_A1->CCTL[0] &= ~TIMER_A_CCTLN_CCIE;           // Stop and park at offset
+        TIMER_A1->CCTL[1]  = 0;                             // No ADC trigger edges either
+        send_DAC(mV_DAC(currentWave.offset));
+    }
+}
+
+int running_Generator(void){
+    return (TIMER_A1->CCTL[0] & TIMER_A_CCTLN_CCIE) != 0;
+}
+
+/* sync_Generator()
+ *  Stops TA1, restarts output from phase 0 and starts the TA1.1 ADC trigger.
+ *  Turn output off (no trigger edges), start the ADC on SHS_3, then call
+ *  this so the ADC sees every edge from the first.
+ */
+void sync_Generator(void){
+    unsigned int period = GEN_TIMER_CLOCK/GEN_SAMPLE_RATE;
+    TIMER_A1->CTL    &= ~TIMER_A_CTL_MC_MASK;               // Stop
+    TIMER_A1->CTL    |=  TIMER_A_CTL_CLR;
+    phase = 0;
+    TIMER_A1->CCR[1]  = period/2;                           // Set at CCR1, reset at CCR0
+    TIMER_A1->CCTL[1] = TIMER_A_CCTLN_OUTMOD_3;
+    TIMER_A1->CCTL[0] &= ~TIMER_A_CCTLN_CCIFG;
+    TIMER_A1->CCTL[0] |=  TIMER_A_CCTLN_CCIE;
+    TIMER_A1->CTL    |=  TIMER_A_CTL_MC__UP;
+}
+
+/* phase_Generator()
+ *
+ * Parameters:
+ *  sample - DAC sample number since sync_Generator, 0 first
+ *
+ * Returns:
+ *  Phase accumulator for that sample, 2^32 = 1 period, truncated to the
+ *  table entry actually sent
+ */
+unsigned int phase_Generator(unsigned int sample){
+    unsigned int value = sample*phaseStep;                  // Wraps mod 2^32 like phase
+    return value & ~((1u << (32 - GEN_TABLE_BITS)) - 1);
+}
+
+/* build_Table()
+ *  Fills a table with one period in DAC codes
+ *
+ * Parameters:
+ *  wave  - Waveform to build, already range checked
+ *  table - GEN_TABLE_LENGTH entries
+ */
+static void build_Table(const WaveData * wave, unsigned short * table){
+    int high = GEN_TABLE_LENGTH*wave->duty/100;             // Entries high for square
+    int half = wave->amplitude/2;
+    int i;
+    for(i = 0; i < GEN_TABLE_LENGTH; i++){
+        int level;                                          // -32768 to 32767 over one period
+        switch(wave->form){
+        case square:
+            level = (i < high) ? 32767 : -32768;
+            break;
+        case saw:
+            level = i*65536/GEN_TABLE_LENGTH - 32768;
+            break;
+        case triangle:
+            level = (i < GEN_TABLE_LENGTH/2) ? i*131072/GEN_TABLE_LENGTH - 32768 :
+                                                98304 - i*131072/GEN_TABLE_LENGTH;
+            break;
+        default:
+            level = sin_Fixed(i*(FIXED_TURN/GEN_TABLE_LENGTH));
+            break;
+        }
+        table[i] = mV_DAC((int)wave->offset + (half*level)/32768);
+    }
+}
+
+/* TA1_0_IRQHandler()
+ *  Sends next sample first so output timing does not depend on the math
+ */
+void TA1_0_IRQHandler(void){
+    TRACE_ENTER(TRACE_TA1);
+    PROFILE_START(PROBE_GENERATOR);
+    send_DAC(activeTable[phase >> (32 - GEN_TABLE_BITS)]);
+    phase += phaseStep;
+    TIMER_A1->CCTL[0] &= ~TIMER_A_CCTLN_CCIFG;              // Clear flag on exit
+    PROFILE_STOP(PROBE_GENERATOR);
+    TRACE_EXIT(TRACE_TA1);
+}
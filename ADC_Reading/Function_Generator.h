@@ -0,0 +1,78 @@
+/*
+ * Function_Generator.h
+ *
+ *   This libary holds a table driven waveform generator for the DAC
+ *      init_Generator     - Starts DAC and sample timer, output off
+ *      set_Wave_Generator - Checks a waveform and switches to it
+ *      get_Wave_Generator - Returns waveform currently set
+ *      output_Generator   - Turns output on or off
+ *      running_Generator  - Returns if output is on
+ *      sync_Generator     - Restarts output at phase 0 with an ADC trigger
+ *      phase_Generator    - Phase of any sample since sync_Generator
+ *
+ *   TA1 CCR0 interrupts at GEN_SAMPLE_RATE and sends one table entry per
+ *   interrupt. A 32 bit phase accumulator steps through the table so any
+ *   whole Hz frequency comes from the same sample rate. Tables are built
+ *   in the calling thread in DAC codes, amplitude and offset included,
+ *   and swapped in whole so the ISR never sees half a change.
+ *
+ *   sync_Generator restarts TA1 with sample 0 at phase 0 and a TA1.1
+ *   rising edge half way through every period for ADC14 (SHS_3), so ADC
+ *   sample k sees DAC sample k-1 and the phase of every stimulus sample is
+ *   known exactly from the same clock.
+ *
+ * Depenedencies:
+ *   MSP.h -  Needed for direct register access
+ *   DAC.h -  Output over SPI
+ *   Fixed_Math.h - sin_Fixed while building sine table
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   May  3, 2017 - Initial Creation
+ *   Oct 19, 2026 - Phase accumulator generator with amplitude and offset
+ *   Oct 19, 2026 - Synchronous restart and ADC trigger for response measurement
+ *   Oct 19, 2026 - No math.h
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef FUNCTION_GENERATOR_H_
+#define FUNCTION_GENERATOR_H_
+#include "msp.h"
+#include "DAC.h"
+
+#define GEN_TIMER_CLOCK     48000000    // SMCLK
+#define GEN_SAMPLE_RATE     20000       // DAC updates per second
+#define GEN_TABLE_BITS      8           // Table entries = 2^GEN_TABLE_BITS
+#define GEN_TABLE_LENGTH    (1 << GEN_TABLE_BITS)
+#define GEN_MAX_FREQ        (GEN_SAMPLE_RATE/10)  // At least 10 samples per period
+
+//Enum for waveform for easier configurations
+typedef enum{
+    square,
+    saw,
+    sine,
+    triangle
+}Waveform;
+
+//Data struct for complete wavedata
+typedef struct{
+    Waveform     form;
+    unsigned int freq;                  // Hz, 1-GEN_MAX_FREQ
+    unsigned int duty;                  // Percent high for square, 1-99
+    unsigned int amplitude;             // Peak to peak in mV
+    unsigned int offset;                // Center voltage in mV
+}WaveData;
+
+void init_Generator(void);
+int  set_Wave_Generator(const WaveData * wave);
+void get_Wave_Generator(WaveData * wave);
+void output_Generator(int on);
+int  running_Generator(void);
+void sync_Generator(void);
+unsigned int phase_Generator(unsigned int sample);
+
+#endif /* FUNCTION_GENERATOR_H_ */
@@ -0,0 +1,142 @@
+/*
+ *  Goertzel.c
+ *    This holds the Goertzel tone bank
+ *    See Goertzel.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *   Oct 19, 2026 - Integer level root, no float per result
+ *   Oct 19, 2026 - Profile probe
+ *   Oct 19, 2026 - Tones next to their own image refused
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Goertzel.h"
+#include "Fixed_Math.h"
+#include "Profile.h"
+#include <math.h>
+
+#define PI 3.14159265f
+
+/* check_Goertzel()
+ *  A tone closer than GOERTZEL_NYQUIST_BINS bins to rate/2 can not be told
+ *  apart from its own image at rate - f in length samples
+ *
+ * Parameters:
+ *  freq   - Tone in Hz
+ *  rate   - Samples per second
+ *  length - Samples per result, 1 to GOERTZEL_MAX_LENGTH
+ *
+ * Returns:
+ *  0  - Tone can be measured
+ *  -1 - Tone is 0, too close to rate/2, or length out of range
+ */
+int check_Goertzel(unsigned int freq, unsigned int rate, unsigned int length){
+    if(0 == freq || 2*freq >= rate || 0 == length || GOERTZEL_MAX_LENGTH < length){
+        return -1;
+    }
+    //rate/2 - freq >= GOERTZEL_NYQUIST_BINS*rate/length, no divide
+    if((unsigned long long)(rate - 2*freq)*length < 2ull*GOERTZEL_NYQUIST_BINS*rate){
+        return -1;
+    }
+    return 0;
+}
+
+/* set_Goertzel()
+ *
+ * Parameters:
+ *  bank   - Bank to set up
+ *  freqs  - Tone frequencies in Hz, each passing check_Goertzel
+ *  count  - Number of tones, 1 to GOERTZEL_MAX_TONES
+ *  rate   - Samples per second
+ *  length - Samples per result_Goertzel call
+ *
+ * Returns:
+ *  0  - Set, states cleared
+ *  -1 - Bad count or frequency, bank unchanged
+ */
+int set_Goertzel(Goertzel * bank, const unsigned int * freqs, unsigned int count,
+                 unsigned int rate, unsigned int length){
+    unsigned int tone;
+    if(0 == count || GOERTZEL_MAX_TONES < count){
+        return -1;
+    }
+    for(tone = 0; tone < count; tone++){
+        if(check_Goertzel(freqs[tone], rate, length)){
+            return -1;
+        }
+    }
+    for(tone = 0; tone < count; tone++){
+        float coef = 2.0f*cosf(2*PI*freqs[tone]/rate);
+        bank->freq[tone] = freqs[tone];
+        bank->coef[tone] = (int)lroundf(coef*(1 << GOERTZEL_SHIFT));
+        bank->s1[tone]   = 0;
+        bank->s2[tone]   = 0;
+    }
+    bank->count   = count;
+    bank->samples = 0;
+    return 0;
+}
+
+/* run_Goertzel()
+ *
+ * Parameters:
+ *  bank    - Bank to feed
+ *  samples - Raw ADC results in time order
+ *  count   - Number of samples, total since result_Goertzel at most
+ *            GOERTZEL_MAX_LENGTH
+ */
+void run_Goertzel(Goertzel * bank, const unsigned short * samples, unsigned int count){
+    unsigned int sum = 0;
+    unsigned int tone, i;
+    int mean;
+    PROFILE_START(PROBE_GOERTZEL);
+
+    if(0 == count){
+        return;
+    }
+    for(i = 0; i < count; i++){
+        sum += samples[i];
+    }
+    mean = (int)(sum/count);
+
+    for(tone = 0; tone < bank->count; tone++){          // One tone at a time keeps state in registers
+        int coef = bank->coef[tone];
+        int s1 = bank->s1[tone];
+        int s2 = bank->s2[tone];
+        for(i = 0; i < count; i++){
+            int s0 = ((int)samples[i] - mean) + (int)(((long long)coef*s1) >> GOERTZEL_SHIFT) - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+        bank->s1[tone] = s1;
+        bank->s2[tone] = s2;
+    }
+    bank->samples += count;
+    PROFILE_STOP(PROBE_GOERTZEL);
+}
+
+/* result_Goertzel()
+ *  Power is s1^2 + s2^2 - coef*s1*s2, peak amplitude is 2*sqrt(power)/N
+ *
+ * Parameters:
+ *  bank   - Bank to read, states are cleared for the next block
+ *  levels - One per tone, peak amplitude in raw counts Q4
+ */
+void result_Goertzel(Goertzel * bank, unsigned int * levels){
+    unsigned int tone;
+    for(tone = 0; tone < bank->count; tone++){
+        long long s1 = bank->s1[tone];
+        long long s2 = bank->s2[tone];
+        long long power = s1*s1 + s2*s2 - ((((long long)bank->coef[tone]*s1) >> GOERTZEL_SHIFT)*s2);
+        //2*sqrt(power) in Q GOERTZEL_LEVEL_BITS as one root, power is at most (N*2^13)^2 = 2^46
+        levels[tone] = bank->samples ?
+            sqrt64_Fixed((unsigned long long)(power > 0 ? power : 0) << (2*(GOERTZEL_LEVEL_BITS + 1)))/bank->samples : 0;
+        bank->s1[tone] = 0;
+        bank->s2[tone] = 0;
+    }
+    bank->samples = 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * Goertzel.h
+ *
+ *   This libary holds a bank of Goertzel filters for tone levels
+ *      check_Goertzel  - Tells if a tone can be measured at a rate and length
+ *      set_Goertzel    - Sets target frequencies and clears the bank
+ *      run_Goertzel    - Feeds a block of raw samples to every tone
+ *      result_Goertzel - Returns the level of each tone and starts over
+ *
+ *   Each tone costs one 32x32 multiply and two adds per sample,
+ *   s = x + coef*s1 - s2 with coef = 2cos(2*pi*f/rate) in Q29 so tones
+ *   close to DC still land where asked. The block mean is taken off first
+ *   so DC does not leak into low tones. Tones need not be whole bins of
+ *   the block length, a tone between bins reads a little low. Bins are
+ *   rate/N Hz wide for N samples, a tone needs a few periods per block to
+ *   be told apart from its neighbours. Near rate/2 the tone's own image at
+ *   rate - f is a neighbour too, so tones within GOERTZEL_NYQUIST_BINS bins
+ *   of rate/2 are refused. Host_Tools/goertzel_check.py shows how far off
+ *   such a level would be.
+ *
+ *   Levels are peak amplitude in raw ADC counts, Q4. States stay under
+ *   2^31 for blocks up to GOERTZEL_MAX_LENGTH samples at full scale.
+ *
+ * Depenedencies:
+ *   math.h       - cosf for coefficients
+ *   Fixed_Math.h - Integer square root for levels
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *   Oct 19, 2026 - Levels without float
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef GOERTZEL_H_
+#define GOERTZEL_H_
+
+#define GOERTZEL_MAX_TONES  8
+#define GOERTZEL_MAX_LENGTH 1024        // Samples between result_Goertzel calls
+#define GOERTZEL_SHIFT      29          // Coefficient fraction bits
+#define GOERTZEL_LEVEL_BITS 4           // Level fraction bits
+#define GOERTZEL_NYQUIST_BINS 2         // Closest a tone may be to rate/2, tone and image 4 bins apart
+
+//Data struct for a bank of tones
+typedef struct{
+    unsigned int count;                 // Tones in use
+    unsigned int samples;               // Samples since last result
+    unsigned int freq[ GOERTZEL_MAX_TONES ];
+    int          coef[ GOERTZEL_MAX_TONES ];
+    int          s1[ GOERTZEL_MAX_TONES ];
+    int          s2[ GOERTZEL_MAX_TONES ];
+}Goertzel;
+
+int  check_Goertzel(unsigned int freq, unsigned int rate, unsigned int length);
+int  set_Goertzel(Goertzel * bank, const unsigned int * freqs, unsigned int count,
+                  unsigned int rate, unsigned int length);
+void run_Goertzel(Goertzel * bank, const unsigned short * samples, unsigned int count);
+void result_Goertzel(Goertzel * bank, unsigned int * levels);
+
+#endif /* GOERTZEL_H_ */
@@ -0,0 +1,114 @@
+/*
+ *  Linearity.c
+ *    This holds the DAC sweep and line fit
+ *    See Linearity.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Linearity.h"
+
+static unsigned int measure_Point(unsigned int code);
+
+/* run_Linearity()
+ *  Sweeps every curve point, fits the line and sets the curve in use.
+ *  Leaves the DAC at code 0.
+ *
+ * Parameters:
+ *  result - Filled with fit and INL
+ *
+ * Returns:
+ *  0  - Curve set
+ *  -1 - Fewer than two points off the rails, nothing wired, curve unchanged
+ */
+int run_Linearity(LinearityResult * result){
+    static unsigned short curve[ DAC_CAL_POINTS ];          // mV, Q DAC_CAL_BITS, off the stack
+    long long sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+    unsigned int low  = LINEARITY_MARGIN_MV << DAC_CAL_BITS;
+    unsigned int high = (DAC_VREF_MV - LINEARITY_MARGIN_MV) << DAC_CAL_BITS;
+    unsigned int i, n = 0;
+    float slope, intercept, worst = 0.0f;
+
+    result->reversals = 0;
+    for(i = 0; i < DAC_CAL_POINTS; i++){
+        curve[i] = (unsigned short)measure_Point(DAC_CAL_CODE(i));
+        if(i && curve[i] < curve[i - 1]){                   // Noise at a rail, keep curve non-decreasing
+            curve[i] = curve[i - 1];
+            result->reversals++;
+        }
+        if(curve[i] >= low && curve[i] <= high){
+            sumX  += DAC_CAL_CODE(i);
+            sumY  += curve[i];
+            sumXX += (long long)DAC_CAL_CODE(i)*DAC_CAL_CODE(i);
+            sumXY += (long long)DAC_CAL_CODE(i)*curve[i];
+            n++;
+        }
+    }
+    send_DAC(0);
+
+    result->fitted = n;
+    if(n < 2){
+        return -1;
+    }
+
+    //Least squares, sums are exact so only the solve is float
+    slope     = (float)(n*sumXY - sumX*sumY)/(float)(n*sumXX - sumX*sumX);
+    intercept = ((float)sumY - slope*(float)sumX)/n;
+
+    result->inlCode = 0;
+    for(i = 0; i < DAC_CAL_POINTS; i++){
+        float error;
+        if(curve[i] < low || curve[i] > high){
+            continue;
+        }
+        error = (float)curve[i] - (slope*DAC_CAL_CODE(i) + intercept);
+        if(error < 0.0f){
+            error = -error;
+        }
+        if(error > worst){
+            worst = error;
+            result->inlCode = DAC_CAL_CODE(i);
+        }
+    }
+
+    result->gain   = (int)(slope*1000.0f/(1 << DAC_CAL_BITS) + 0.5f);
+    result->offset = (int)(intercept*1000.0f/(1 << DAC_CAL_BITS) + (intercept < 0.0f ? -0.5f : 0.5f));
+    result->inl    = (slope > 0.0f) ? (unsigned int)(worst*100.0f/slope + 0.5f) : 0;
+
+    set_DAC_Calibration(curve);
+    return 0;
+}
+
+/* measure_Point()
+ *  Outputs code, lets it settle and averages conversions
+ *
+ * Returns:
+ *  Output in mV, Q DAC_CAL_BITS
+ */
+static unsigned int measure_Point(unsigned int code){
+    const CalData * cal = get_Calibration();
+    unsigned int sum = 0, i;
+    long long scaled;
+
+    send_DAC(code);
+    for(i = 0; i < LINEARITY_SETTLE + LINEARITY_SAMPLES; i++){
+        run_ADC();
+        while(!hasNew_ADC());                               // Single conversion is a few us
+        if(i >= LINEARITY_SETTLE){
+            sum += get_Raw_ADC();
+        }
+    }
+
+    //mV_ADC with DAC_CAL_BITS of fraction kept
+    scaled = (((long long)sum*cal->gain) >> LINEARITY_SHIFT) + cal->offset;
+    if(scaled < 0){
+        return 0;
+    }
+    scaled = (scaled + (1 << (15 - DAC_CAL_BITS))) >> (16 - DAC_CAL_BITS);
+    return (scaled > 0xFFFF) ? 0xFFFF : (unsigned int)scaled;
+}
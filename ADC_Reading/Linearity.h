@@ -0,0 +1,54 @@
+/*
+ * Linearity.h
+ *
+ *   This libary measures the DAC transfer curve through the ADC
+ *      run_Linearity - Sweeps DAC codes, fits gain, offset and INL, sets curve
+ *
+ *   DAC output must be wired to ADC_DEFAULT_INPUT and the ADC calibrated
+ *   first, the ADC is the reference. Every DAC_CAL_STEP codes the output
+ *   is settled and averaged over LINEARITY_SAMPLES single conversions.
+ *   Points away from the rails are fit with a least squares line, INL is
+ *   the largest distance of a point from it. Every point, rails included,
+ *   goes to set_DAC_Calibration so mV_DAC lands on the measured curve.
+ *
+ *   Blocks for under 100 ms, ADC single mode and DAC must be idle.
+ *
+ * Depenedencies:
+ *   ADC.h         - Single conversions
+ *   DAC.h         - Output under test
+ *   Calibration.h - Curve storage
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef LINEARITY_H_
+#define LINEARITY_H_
+#include "ADC.h"
+#include "DAC.h"
+#include "Calibration.h"
+
+#define LINEARITY_SHIFT     8           // Points average 2^8 conversions
+#define LINEARITY_SAMPLES   (1 << LINEARITY_SHIFT)
+#define LINEARITY_SETTLE    8           // Conversions thrown away after each code change
+#define LINEARITY_MARGIN_MV 50          // Points this close to a rail are left out of the fit
+
+//Data struct for sweep result
+typedef struct{
+    int          gain;                  // uV per code
+    int          offset;                // uV at code 0
+    unsigned int inl;                   // Worst distance from fit, 0.01 LSB
+    unsigned int inlCode;               // Code of worst point
+    unsigned int fitted;                // Points in the fit
+    unsigned int reversals;             // Points lower than the one before, set equal in curve
+}LinearityResult;
+
+int run_Linearity(LinearityResult * result);
+
+#endif /* LINEARITY_H_ */
@@ -0,0 +1,55 @@
+/*
+ *  Log.c
+ *    This holds the record builder for deferred binary logging
+ *    See Log.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Log.h"
+
+static volatile unsigned int dropped;                   // Records that did not fit
+
+/* log_Record()
+ *  Builds one record on the stack and queues it whole
+ *
+ * Parameters:
+ *  format - Format string in .logstr, its address is the ID
+ *  count  - Number of arguments used, 0-4
+ *  a - d  - Raw argument words
+ */
+void log_Record(const char * format, unsigned int count, unsigned int a,
+                unsigned int b, unsigned int c, unsigned int d){
+    unsigned int words[LOG_MAX_ARGS + 2];               // Word aligned for fast stores
+    unsigned char * record = (unsigned char *)words + 2;// Leaves header in bytes 2-3
+
+    record[0] = LOG_SYNC;
+    record[1] = count;
+    words[1]  = (unsigned int)format;                   // ID, CPU is little endian
+    words[2]  = a;                                      // Arguments follow ID
+    words[3]  = b;
+    words[4]  = c;
+    words[5]  = d;
+
+    if(!write_Whole_UART((const char *)record, 6 + 4*count)){
+        dropped++;
+    }
+}
+
+unsigned int float_Bits_Log(float value){
+    union{
+        float        f;
+        unsigned int u;
+    }bits;
+    bits.f = value;
+    return bits.u;
+}
+
+unsigned int dropped_Log(void){
+    return dropped;
+}
@@ -0,0 +1,67 @@
+/*
+ * Log.h
+ *
+ *   This libary holds deferred binary logging over UART
+ *      LOG0 - LOG4    - Logs a format string with 0-4 arguments
+ *      LOG_FLOAT      - Passes a float argument as its raw bits
+ *      log_Record     - Queues one record (called by LOG macros)
+ *      dropped_Log    - Returns records dropped because TX buffer was full
+ *
+ *   Format strings are never sent or formatted on the MCU. Each one is
+ *   placed in the .logstr section and its address is sent as the ID,
+ *   followed by raw 32 bit argument words. Host_Tools/log_decode.py reads
+ *   the strings back out of the .out file and does the formatting.
+ *
+ *   Record: 0xA5 | count (1) | format address (4) | count words (4 each),
+ *   all little endian. 0xA5 is not ASCII so records can share the UART
+ *   with normal text.
+ *
+ *   Safe to call from ISRs, a record costs a few dozen cycles.
+ *   Arguments must be integers or pointers, wrap floats in LOG_FLOAT.
+ *
+ * Depenedencies:
+ *   UART.h - Records are queued whole on the TX buffer or not at all
+ *   msp432p401r.cmd - Must place .logstr in flash
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef LOG_H_
+#define LOG_H_
+#include "UART.h"
+
+#define LOG_SYNC        0xA5            // First byte of every record
+#define LOG_MAX_ARGS    4
+
+//Puts the format string in its own section, address becomes the record ID
+#define LOG_STRING(format) \
+    static const char logFormat[] __attribute__((section(".logstr"))) = format
+
+#define LOG0(format)            do{ LOG_STRING(format); \
+    log_Record(logFormat, 0, 0, 0, 0, 0); }while(0)
+#define LOG1(format, a)         do{ LOG_STRING(format); \
+    log_Record(logFormat, 1, (unsigned int)(a), 0, 0, 0); }while(0)
+#define LOG2(format, a, b)      do{ LOG_STRING(format); \
+    log_Record(logFormat, 2, (unsigned int)(a), (unsigned int)(b), 0, 0); }while(0)
+#define LOG3(format, a, b, c)   do{ LOG_STRING(format); \
+    log_Record(logFormat, 3, (unsigned int)(a), (unsigned int)(b), (unsigned int)(c), 0); }while(0)
+#define LOG4(format, a, b, c, d) do{ LOG_STRING(format); \
+    log_Record(logFormat, 4, (unsigned int)(a), (unsigned int)(b), (unsigned int)(c), \
+               (unsigned int)(d)); }while(0)
+
+//Raw bits of a float, host formats %f/%e/%g arguments from these
+#define LOG_FLOAT(value)        (float_Bits_Log(value))
+
+void log_Record(const char * format, unsigned int count, unsigned int a,
+                unsigned int b, unsigned int c, unsigned int d);
+unsigned int float_Bits_Log(float value);
+unsigned int dropped_Log(void);
+
+#endif /* LOG_H_ */
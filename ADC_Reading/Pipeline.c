@@ -0,0 +1,108 @@
+/*
+ *  Pipeline.c
+ *    This holds the ADC sample handler that filters to the DAC
+ *    See Pipeline.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Pipeline.h"
+#include "Cycles.h"
+
+static volatile PipelineStats measured;                     // Handler writes, clear_Pipeline resets
+static volatile int clearRequest;
+static unsigned int lateBase;                               // overrun_ADC at last clear
+static int running;
+
+static void process_Sample(unsigned int raw);
+
+/* start_Pipeline()
+ *
+ * Parameters:
+ *  rate - Samples per second, ADC_MIN_RATE to ADC_MAX_RATE
+ *
+ * Returns:
+ *  0  - Running
+ *  -1 - Rate out of range, nothing changed
+ */
+int start_Pipeline(unsigned int rate){
+    if(ADC_MIN_RATE > rate || ADC_MAX_RATE < rate){
+        return -1;
+    }
+    init_DAC();
+    init_Cycles();
+    clearRequest = 1;
+    lateBase = 0;                                           // start_Sample_ADC zeroes overruns
+    running = 1;
+    return start_Sample_ADC(rate, process_Sample);
+}
+
+void stop_Pipeline(void){
+    stop_Continuous_ADC();
+    running = 0;
+}
+
+int running_Pipeline(void){
+    return running;
+}
+
+/* stats_Pipeline()
+ *  Copies measurements with the ADC interrupt held off so they agree
+ */
+void stats_Pipeline(PipelineStats * stats){
+    unsigned int primask = __get_PRIMASK();
+    __disable_irq();
+    stats->samples    = measured.samples;
+    stats->cycleSum   = measured.cycleSum;
+    stats->cycleMax   = measured.cycleMax;
+    stats->latencyMax = measured.latencyMax;
+    stats->late       = overrun_ADC() - lateBase;
+    __set_PRIMASK(primask);
+}
+
+/* clear_Pipeline()
+ *  Handler clears at its next sample so no sum is cut in half
+ */
+void clear_Pipeline(void){
+    lateBase = overrun_ADC();
+    clearRequest = 1;
+}
+
+/* process_Sample()
+ *  ADC sample handler, filter and DAC write
+ */
+static void process_Sample(unsigned int raw){
+    unsigned int start = get_Cycles();
+    unsigned int cycles;
+    unsigned int latency;
+    int value;
+
+    value = run_Filter((int)raw - PIPELINE_MID) + PIPELINE_MID;
+    value >>= PIPELINE_SHIFT;
+    if(value < 0)        value = 0;
+    if(value > DAC_MAX)  value = DAC_MAX;
+    send_DAC(value);                                        // Returns once DAC has the word
+
+    latency = trigger_Age_ADC();
+    cycles  = get_Cycles() - start;
+    if(clearRequest){
+        measured.samples    = 0;
+        measured.cycleSum   = 0;
+        measured.cycleMax   = 0;
+        measured.latencyMax = 0;
+        clearRequest = 0;
+    }
+    measured.samples++;
+    measured.cycleSum += cycles;
+    if(cycles > measured.cycleMax){
+        measured.cycleMax = cycles;
+    }
+    if(latency > measured.latencyMax){
+        measured.latencyMax = latency;
+    }
+}
@@ -0,0 +1,59 @@
+/*
+ * Pipeline.h
+ *
+ *   This libary holds the sample by sample ADC to DAC filter path
+ *      start_Pipeline - Samples at a rate, filters and outputs each sample
+ *      stop_Pipeline  - Stops sampling, DAC holds last output
+ *      running_Pipeline - Returns whether the pipeline is running
+ *      stats_Pipeline - Returns cost and latency since start or last clear
+ *      clear_Pipeline - Restarts the cost and latency measurement
+ *
+ *   Each TA0.1 edge starts a conversion of ADC_DEFAULT_INPUT, the ADC
+ *   interrupt centers the result, runs it through run_Filter (Filter.h) and
+ *   writes it to the MCP4921, waiting until the DAC has it. Latency is
+ *   measured from the trigger edge to that point with the trigger timer,
+ *   so it holds conversion time, interrupt entry, filter and SPI. The
+ *   output is later than the input by that latency every sample, the
+ *   worst case must stay under one period or samples are lost (late).
+ *
+ * Depenedencies:
+ *   ADC.h    - Sample mode and trigger timer
+ *   DAC.h    - Output
+ *   Filter.h - Processing
+ *   Cycles.h - Cost measurement
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef PIPELINE_H_
+#define PIPELINE_H_
+#include "ADC.h"
+#include "DAC.h"
+#include "Filter.h"
+
+#define PIPELINE_MID    8192            // ADC code for zero after centering
+#define PIPELINE_SHIFT  2               // 14 bit ADC to 12 bit DAC
+
+//Data struct for measurements
+typedef struct{
+    unsigned int       samples;         // Samples processed
+    unsigned long long cycleSum;        // Cycles in handler, filter and DAC write
+    unsigned int       cycleMax;
+    unsigned int       latencyMax;      // ADC_TIMER_CLOCK ticks, trigger to DAC loaded
+    unsigned int       late;            // Samples lost, handler ran past next one
+}PipelineStats;
+
+int  start_Pipeline(unsigned int rate);
+void stop_Pipeline(void);
+int  running_Pipeline(void);
+void stats_Pipeline(PipelineStats * stats);
+void clear_Pipeline(void);
+
+#endif /* PIPELINE_H_ */
@@ -0,0 +1,65 @@
+/*
+ *  Profile.c
+ *    This holds the probe counters
+ *    See Profile.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Profile.h"
+
+#if PROFILE_ENABLE
+
+ProfileStats PROFILE_STATS[ PROFILE_PROBES ];
+
+static const char * const PROFILE_NAMES[ PROFILE_PROBES ] = {
+    "generator", "block", "frame", "goertzel"
+};
+static unsigned int overhead;
+
+/* init_Profile()
+ *  Clears probes and times an empty START and STOP, the least any probe
+ *  can record
+ */
+void init_Profile(void){
+    unsigned int start;
+    init_Cycles();
+    start = get_Cycles();
+    overhead = get_Cycles() - start;
+    clear_Profile();
+}
+
+void get_Profile(ProfileProbe probe, ProfileStats * stats){
+    unsigned int state = __get_PRIMASK();
+    __disable_irq();                                        // No half updated copy
+    *stats = PROFILE_STATS[ probe ];
+    __set_PRIMASK(state);
+}
+
+void clear_Profile(void){
+    unsigned int state = __get_PRIMASK();
+    unsigned int i;
+    __disable_irq();
+    for(i = 0; i < PROFILE_PROBES; i++){
+        PROFILE_STATS[i].count = 0;
+        PROFILE_STATS[i].min   = 0xFFFFFFFF;
+        PROFILE_STATS[i].max   = 0;
+        PROFILE_STATS[i].total = 0;
+    }
+    __set_PRIMASK(state);
+}
+
+const char * name_Profile(ProfileProbe probe){
+    return PROFILE_NAMES[ probe ];
+}
+
+unsigned int overhead_Profile(void){
+    return overhead;
+}
+
+#endif
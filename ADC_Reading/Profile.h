@@ -0,0 +1,101 @@
+/*
+ * Profile.h
+ *
+ *   This libary holds named cycle count probes for hot paths
+ *      PROFILE_START    - Marks the start of a probed section
+ *      PROFILE_STOP     - Marks the end, records cycles since the start
+ *      init_Profile     - Clears every probe and measures probe overhead
+ *      get_Profile      - Copies one probe's counters
+ *      clear_Profile    - Clears every probe
+ *      name_Profile     - Returns a probe's name
+ *      overhead_Profile - Returns cycles one empty probe pair records
+ *
+ *   Each probe keeps count, min, max and total DWT cycles. Sections are
+ *   recorded with interrupts masked for a few cycles so ISRs and the
+ *   main loop can share a probe, readers copy under the same mask.
+ *   PROFILE_START declares a variable, so it goes last in a block's
+ *   declarations, with STOP later in the same block.
+ *
+ *   With PROFILE_ENABLE 0 the macros and init_Profile are empty and
+ *   nothing here is compiled in, set it to 1 here or with -DPROFILE_ENABLE=1 to profile.
+ *   Add a probe by adding it to ProfileProbe and its name to
+ *   PROFILE_NAMES in Profile.c.
+ *
+ * Depenedencies:
+ *   Cycles.h - DWT cycle counter
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+#include "Cycles.h"
+
+#ifndef PROFILE_ENABLE
+#define PROFILE_ENABLE      0           // 1 to compile probes in
+#endif
+
+//Probe points, PROFILE_NAMES holds the same order
+typedef enum{
+    PROBE_GENERATOR,                    // TA1 generator ISR, table lookup and DAC write
+    PROBE_BLOCK,                        // DMA block complete ISR
+    PROBE_FRAME,                        // CRC, COBS and queueing of one stream frame
+    PROBE_GOERTZEL,                     // One block through the tone bank
+    PROFILE_PROBES
+}ProfileProbe;
+
+//Data struct for one probe
+typedef struct{
+    unsigned int       count;
+    unsigned int       min;
+    unsigned int       max;
+    unsigned long long total;
+}ProfileStats;
+
+#if PROFILE_ENABLE
+
+extern ProfileStats PROFILE_STATS[ PROFILE_PROBES ];
+
+#define PROFILE_START(probe)    unsigned int profileStart_##probe = get_Cycles()
+#define PROFILE_STOP(probe)     record_Profile(probe, get_Cycles() - profileStart_##probe)
+
+/* record_Profile()
+ *  Used by PROFILE_STOP, inline so a probe costs no call
+ */
+static inline void record_Profile(ProfileProbe probe, unsigned int cycles){
+    ProfileStats * stats = &PROFILE_STATS[ probe ];
+    unsigned int state = __get_PRIMASK();
+    __disable_irq();
+    stats->count++;
+    stats->total += cycles;
+    if(cycles < stats->min){
+        stats->min = cycles;
+    }
+    if(cycles > stats->max){
+        stats->max = cycles;
+    }
+    __set_PRIMASK(state);
+}
+
+void init_Profile(void);
+void get_Profile(ProfileProbe probe, ProfileStats * stats);
+void clear_Profile(void);
+const char * name_Profile(ProfileProbe probe);
+unsigned int overhead_Profile(void);
+
+#else
+
+#define PROFILE_START(probe)
+#define PROFILE_STOP(probe)
+#define init_Profile()
+
+#endif
+
+#endif /* PROFILE_H_ */
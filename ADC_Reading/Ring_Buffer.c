@@ -0,0 +1,164 @@
+/*
+ *  Ring_Buffer.c
+ *    This holds the functions for the single producer/single consumer ring
+ *    See Ring_Buffer.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *   Oct 19, 2026 - peek/skip added so DMA can drain the ring in place
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Ring_Buffer.h"
+
+/* init_Ring()
+ *  Attaches storage to a ring and clears all indexes
+ *
+ * Parameters:
+ *  ring   - Ring to configure
+ *  data   - Storage for the ring
+ *  length - Length of storage, must be a power of two
+ *
+ * Returns:
+ *  0  - No Error
+ *  -1 - Length is not a power of two
+ */
+int init_Ring(RingBuffer * ring, char * data, unsigned int length){
+    if(0 == length || 0 != (length & (length - 1))){  // Masking only works for 2^n
+        return -1;
+    }
+    ring->data     = data;
+    ring->mask     = length - 1;
+    ring->head     = 0;
+    ring->tail     = 0;
+    ring->overflow = 0;
+    return 0;
+}
+
+unsigned int used_Ring(const RingBuffer * ring){
+    return ring->head - ring->tail;             // Unsigned math handles index rollover
+}
+
+unsigned int free_Ring(const RingBuffer * ring){
+    return (ring->mask + 1) - (ring->head - ring->tail);
+}
+
+/* put_Ring()
+ *  Adds one byte to the ring, byte is dropped and counted if ring is full
+ *
+ * Returns:
+ *  1 - Byte added
+ *  0 - Ring full
+ */
+int put_Ring(RingBuffer * ring, char data){
+    unsigned int head = ring->head;
+    if((head - ring->tail) > ring->mask){       // No room left
+        ring->overflow++;
+        return 0;
+    }
+    ring->data[head & ring->mask] = data;       // Store then publish new head
+    ring->head = head + 1;
+    return 1;
+}
+
+/* get_Ring()
+ *  Removes one byte from the ring
+ *
+ * Returns:
+ *  1 - Byte stored to data
+ *  0 - Ring empty
+ */
+int get_Ring(RingBuffer * ring, char * data){
+    unsigned int tail = ring->tail;
+    if(tail == ring->head){                     // Nothing waiting
+        return 0;
+    }
+    *data = ring->data[tail & ring->mask];      // Read then release the slot
+    ring->tail = tail + 1;
+    return 1;
+}
+
+/* write_Ring()
+ *  Copies a block into the ring, whatever does not fit is dropped and counted
+ *
+ * Returns:
+ *  Number of bytes actually added
+ */
+unsigned int write_Ring(RingBuffer * ring, const char * data, unsigned int length){
+    unsigned int head  = ring->head;
+    unsigned int space = (ring->mask + 1) - (head - ring->tail);
+    unsigned int index = head & ring->mask;
+    unsigned int first;
+
+    if(length > space){                         // Count what will be lost
+        ring->overflow += length - space;
+        length = space;
+    }
+    first = (ring->mask + 1) - index;           // Room before storage wraps
+    if(first > length){
+        first = length;
+    }
+    memcpy(&ring->data[index], data, first);    // Copy up to end of storage
+    memcpy(ring->data, data + first, length - first); // Copy wrapped remainder
+    ring->head = head + length;                 // Publish all bytes at once
+    return length;
+}
+
+/* read_Ring()
+ *  Copies up to length bytes out of the ring
+ *
+ * Returns:
+ *  Number of bytes actually copied
+ */
+unsigned int read_Ring(RingBuffer * ring, char * data, unsigned int length){
+    unsigned int tail  = ring->tail;
+    unsigned int used  = ring->head - tail;
+    unsigned int index = tail & ring->mask;
+    unsigned int first;
+
+    if(length > used){
+        length = used;
+    }
+    first = (ring->mask + 1) - index;           // Bytes before storage wraps
+    if(first > length){
+        first = length;
+    }
+    memcpy(data, &ring->data[index], first);
+    memcpy(data + first, ring->data, length - first);
+    ring->tail = tail + length;                 // Release all slots at once
+    return length;
+}
+
+void flush_Ring(RingBuffer * ring){
+    ring->tail = ring->head;                    // Consumer drops everything waiting
+}
+
+/* peek_Ring()
+ *  Finds the waiting bytes that are contiguous in storage, stops at wrap
+ *
+ * Parameters:
+ *  data - Set to first waiting byte
+ *
+ * Returns:
+ *  Number of contiguous bytes starting at data
+ */
+unsigned int peek_Ring(const RingBuffer * ring, const char ** data){
+    unsigned int tail  = ring->tail;
+    unsigned int used  = ring->head - tail;
+    unsigned int index = tail & ring->mask;
+    unsigned int first = (ring->mask + 1) - index;          // Bytes before storage wraps
+
+    *data = &ring->data[index];
+    return (used < first) ? used : first;
+}
+
+void skip_Ring(RingBuffer * ring, unsigned int length){
+    ring->tail += length;                       // Release slots consumed in place
+}
+
+unsigned int overflow_Ring(const RingBuffer * ring){
+    return ring->overflow;
+}
@@ -0,0 +1,32 @@
+/*
+ * SPI.h
+ *
+ * This holds functions for using SPI on EUSCI_A3
+ *  init_SPI - Starts SPI on EUSCI_A3, Speed = FCPU/2
+ *  send_SPI - Sends one byte of data over SPI
+ *  wait_SPI - Waits for the last byte to finish shifting out
+ *
+ * Dependencies:
+ *  MSP.h
+ *  External Chip Select
+ *  P9 Pins
+ *    9.7 - MOSI
+ *    9.5 - SCLK
+ *
+ * Revisions:
+ *  Apr 24, 2017 - Initial Creation
+ *  May  3, 2017 - Modified to accept 48MHz
+ *  Oct 19, 2026 - Split into SPI.c for assignment 8, wait_SPI added
+ *
+ * Authors: Drew Hartley, Jordan Jones
+ */
+
+#ifndef SPI_H_
+#define SPI_H_
+#include "msp.h"
+
+void init_SPI(void);
+void send_SPI(unsigned int data);
+void wait_SPI(void);
+
+#endif /* SPI_H_ */
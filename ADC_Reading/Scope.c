@@ -0,0 +1,121 @@
+/*
+ *  Scope.c
+ *    This holds the trigger state machine and history ring
+ *    See Scope.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Scope.h"
+
+static void copy_Capture(Scope * scope);
+
+/* init_Scope()
+ *
+ * Parameters:
+ *  scope  - Scope to set up
+ *  config - Trigger settings, copied
+ *
+ * Returns:
+ *  0  - Armed, triggers once pre samples of history are in
+ *  -1 - No post samples or pre + post over SCOPE_LENGTH, scope unchanged
+ */
+int init_Scope(Scope * scope, const ScopeConfig * config){
+    if(0 == config->post || SCOPE_LENGTH < config->post ||
+       SCOPE_LENGTH - config->post < config->pre){
+        return -1;
+    }
+    scope->config   = *config;
+    scope->position = 0;
+    scope->state    = config->pre ? filling : waiting;
+    return 0;
+}
+
+/* update_Scope()
+ *  Runs the trigger on each sample, stops at a finished capture so the
+ *  rest of the block only goes into history
+ *
+ * Parameters:
+ *  scope   - Scope to feed
+ *  samples - Raw ADC results in time order
+ *  count   - Number of samples
+ *
+ * Returns:
+ *  1 - Capture finished in this block, scope->capture holds it
+ *  0 - Nothing new
+ */
+int update_Scope(Scope * scope, const unsigned short * samples, unsigned int count){
+    const ScopeConfig * config = &scope->config;
+    int low  = (int)config->level - (int)config->hysteresis;    // Arming side for rising
+    int high = (int)config->level + (int)config->hysteresis;    // Arming side for falling
+    int done = 0;
+    unsigned int i;
+
+    for(i = 0; i < count; i++){
+        int sample = samples[i];
+        scope->history[ scope->position & (SCOPE_LENGTH - 1) ] = sample;
+        scope->position++;
+
+        switch(scope->state){
+        case filling:
+            if(scope->position >= config->pre){
+                scope->state = waiting;
+            }
+            break;
+        case waiting:
+            if((rising == config->edge && sample <= low) ||
+               (falling == config->edge && sample >= high)){
+                scope->state = ready;
+            }
+            break;
+        case ready:
+            if((rising == config->edge && sample >= (int)config->level) ||
+               (falling == config->edge && sample <= (int)config->level)){
+                scope->trigger   = scope->position - 1;
+                scope->remaining = config->post - 1;    // Trigger sample is the first
+                scope->state     = capturing;
+                if(0 == scope->remaining){
+                    copy_Capture(scope);
+                    done = 1;
+                }
+            }
+            break;
+        case capturing:
+            if(0 == --scope->remaining){
+                copy_Capture(scope);
+                done = 1;
+            }
+            break;
+        case held:
+            break;
+        }
+    }
+    return done;
+}
+
+/* arm_Scope()
+ *  Looks for the next trigger, the held capture may be overwritten from here
+ */
+void arm_Scope(Scope * scope){
+    if(held == scope->state){
+        scope->state = waiting;
+    }
+}
+
+/* copy_Capture()
+ *  Unrolls the last pre + post samples of history in time order and holds
+ */
+static void copy_Capture(Scope * scope){
+    unsigned int length = scope->config.pre + scope->config.post;
+    unsigned int start  = scope->position - length;
+    unsigned int i;
+    for(i = 0; i < length; i++){
+        scope->capture[i] = scope->history[ (start + i) & (SCOPE_LENGTH - 1) ];
+    }
+    scope->state = held;
+}
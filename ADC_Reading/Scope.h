@@ -0,0 +1,79 @@
+/*
+ * Scope.h
+ *
+ *   This libary holds an edge triggered capture with pre-trigger history
+ *      init_Scope   - Checks settings, clears history and arms
+ *      update_Scope - Feeds a block of samples, returns 1 when a capture is done
+ *      arm_Scope    - Waits for the next trigger once a capture has been sent
+ *
+ *   Every sample goes into a SCOPE_LENGTH history ring. While armed a
+ *   rising trigger needs the signal at or below level - hysteresis, then
+ *   at or above level, so noise around the level does not retrigger
+ *   (falling is the mirror image). After the trigger, post more samples
+ *   are stored and pre + post samples ending there are copied out in time
+ *   order, the trigger sample at index pre. History keeps running while
+ *   the capture is held, so arm_Scope can trigger again straight away.
+ *
+ *   Work per sample is a ring store and one or two compares, so it keeps
+ *   up with continuous blocks at ADC_MAX_RATE and no edge in the stream is
+ *   skipped while armed. Blocks dropped by the ADC leave a hole in the
+ *   history, call init_Scope again on a sequence gap.
+ *
+ * Depenedencies:
+ *   None
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef SCOPE_H_
+#define SCOPE_H_
+
+#define SCOPE_LENGTH    512             // History and longest capture, power of two
+
+//Trigger edges
+typedef enum{
+    rising,
+    falling
+}ScopeEdge;
+
+//Data struct for trigger settings
+typedef struct{
+    ScopeEdge    edge;
+    unsigned int level;                 // Raw ADC value
+    unsigned int hysteresis;            // Raw counts away from level needed to arm
+    unsigned int pre;                   // Samples before trigger
+    unsigned int post;                  // Samples from trigger on, at least 1
+}ScopeConfig;
+
+//Scope states
+typedef enum{
+    filling,                            // Less than pre samples of history
+    waiting,                            // Armed, signal not yet on the arming side
+    ready,                              // Armed, next level crossing triggers
+    capturing,                          // Triggered, storing post samples
+    held                                // Capture done, waiting for arm_Scope
+}ScopeState;
+
+//Data struct for one scope
+typedef struct{
+    ScopeConfig    config;
+    ScopeState     state;
+    unsigned int   position;            // Samples seen since init
+    unsigned int   remaining;           // Post samples still to store
+    unsigned int   trigger;             // position of trigger sample
+    unsigned short history[ SCOPE_LENGTH ];
+    unsigned short capture[ SCOPE_LENGTH ];     // pre + post samples, valid when held
+}Scope;
+
+int  init_Scope(Scope * scope, const ScopeConfig * config);
+int  update_Scope(Scope * scope, const unsigned short * samples, unsigned int count);
+void arm_Scope(Scope * scope);
+
+#endif /* SCOPE_H_ */
@@ -0,0 +1,127 @@
+/*
+ *  Shell.c
+ *    This holds the line parser and command dispatch
+ *    See Shell.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Shell.h"
+#include <stdlib.h>
+
+static const Command * commands;
+static unsigned int commandCount;
+static char line[ SHELL_LINE_LENGTH ];
+static LineBuffer input;                                    // Kept between polls until line ends
+
+static void run_Help(void);
+
+void init_Shell(const Command * table, unsigned int count){
+    commands     = table;
+    commandCount = count;
+    init_Line_UART(&input, line, SHELL_LINE_LENGTH);
+}
+
+/* poll_Shell()
+ *  Collects waiting input and runs the command once a line is complete
+ *
+ * Returns:
+ *  1 - A line was handled
+ *  0 - Line not finished yet
+ */
+int poll_Shell(void){
+    char * cursor = line;
+    char * name;
+    unsigned int length, i;
+    int query = 0;
+    int result;
+
+    if(!read_Line_UART(&input)){
+        return 0;
+    }
+    name = get_Token_UART(&cursor);
+    if(0 == name){                                          // Blank line
+        return 1;
+    }
+    length = strlen(name);
+    if(name[length - 1] == '?'){                            // Query form
+        name[length - 1] = 0;
+        query = 1;
+    }
+    if(match_Shell(name, "HELP")){
+        run_Help();
+        return 1;
+    }
+    for(i = 0; i < commandCount; i++){
+        if(match_Shell(name, commands[i].name)){
+            break;
+        }
+    }
+    if(i == commandCount){
+        reply_Shell("ERR unknown command");
+        return 1;
+    }
+
+    result = commands[i].handler(cursor, query);
+    if(SHELL_OK == result){
+        if(!query){                                         // Queries already replied
+            reply_Shell("OK");
+        }
+    }else if(SHELL_NO_QUERY == result){
+        reply_Shell("ERR no query form");
+    }else if(SHELL_QUERY_ONLY == result){
+        reply_Shell("ERR query only");
+    }else if(SHELL_BUSY == result){
+        reply_Shell("ERR busy");
+    }else{
+        reply_Shell("ERR bad argument");
+    }
+    return 1;
+}
+
+int match_Shell(const char * token, const char * word){
+    while(*token && *word){
+        char a = *token++, b = *word++;
+        if(a >= 'a' && a <= 'z') a -= 'a' - 'A';            // Compare as upper case
+        if(b >= 'a' && b <= 'z') b -= 'a' - 'A';
+        if(a != b){
+            return 0;
+        }
+    }
+    return *token == *word;                                 // Both ended together
+}
+
+/* number_Shell()
+ *  Parses a decimal token, rejects empty tokens and trailing junk
+ *
+ * Returns:
+ *  0  - value holds number
+ *  -1 - Not a number
+ */
+int number_Shell(const char * token, long * value){
+    char * end;
+    if(0 == token || 0 == *token){
+        return -1;
+    }
+    *value = strtol(token, &end, 10);
+    return (*end == 0) ? 0 : -1;
+}
+
+void reply_Shell(const char * text){
+    print_String_UART(text);
+    print_String_UART("\r\n");
+}
+
+static void run_Help(void){
+    unsigned int i;
+    for(i = 0; i < commandCount; i++){
+        print_String_UART(commands[i].name);
+        print_String_UART(" - ");
+        reply_Shell(commands[i].help);
+    }
+}
@@ -0,0 +1,64 @@
+/*
+ * Shell.h
+ *
+ *   This libary holds a line based command interpreter over UART
+ *      init_Shell        - Attaches a command table
+ *      poll_Shell        - Runs one command if a full line arrived, never blocks
+ *      match_Shell       - Compares a token to a word ignoring case
+ *      number_Shell      - Parses a whole token as a decimal number
+ *      reply_Shell       - Sends one reply line
+ *
+ *   Commands are SCPI-like, a name followed by space separated arguments.
+ *   "NAME args" sets and replies OK, "NAME?" queries and replies with a
+ *   value. Names match ignoring case. Failures reply "ERR reason".
+ *   Lines are read and run in the calling thread, never in the UART ISR.
+ *
+ * Depenedencies:
+ *   UART.h - Line reader and replies
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef SHELL_H_
+#define SHELL_H_
+#include "UART.h"
+
+#define SHELL_LINE_LENGTH   64          // Longest command line
+#define SHELL_OK            0
+#define SHELL_BAD_ARGUMENT  -1
+#define SHELL_NO_QUERY      -2
+#define SHELL_BUSY          -3
+#define SHELL_QUERY_ONLY    -4
+
+/* Command handler
+ *
+ * Parameters:
+ *  args  - Rest of the line, split further with get_Token_UART
+ *  query - 1 if command ended with '?'
+ *
+ * Returns:
+ *  SHELL_OK or one of the SHELL_ errors, queries reply on their own
+ */
+typedef int (*CommandHandler)(char * args, int query);
+
+//Data struct for one table entry
+typedef struct{
+    const char *   name;
+    CommandHandler handler;
+    const char *   help;                // Shown by HELP
+}Command;
+
+void init_Shell(const Command * table, unsigned int count);
+int  poll_Shell(void);
+int  match_Shell(const char * token, const char * word);
+int  number_Shell(const char * token, long * value);
+void reply_Shell(const char * text);
+
+#endif /* SHELL_H_ */
@@ -0,0 +1,122 @@
+/*
+ *  Statistics.c
+ *    This holds the streaming statistics stage
+ *    See Statistics.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *   Oct 19, 2026 - Square root moved to Fixed_Math
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Statistics.h"
+#include "Fixed_Math.h"
+
+static void clear_Window(Statistics * stats);
+
+void init_Statistics(Statistics * stats){
+    stats->threshold  = STATS_MID_SCALE;
+    stats->hysteresis = STATS_MIN_HYSTERESIS;
+    stats->high       = 0;
+    clear_Window(stats);
+}
+
+/* update_Statistics()
+ *  Adds samples to the window, no divides
+ *
+ * Parameters:
+ *  stats   - Window in progress
+ *  samples - Raw samples of one channel
+ *  count   - Number of samples
+ */
+void update_Statistics(Statistics * stats, const unsigned short * samples, unsigned int count){
+    unsigned long long sum = stats->sum, sumSquares = stats->sumSquares;
+    unsigned int min = stats->min, max = stats->max;
+    unsigned int upper = stats->threshold + stats->hysteresis;
+    unsigned int lower = stats->threshold > stats->hysteresis ? stats->threshold - stats->hysteresis : 0;
+    unsigned int index = stats->count;
+    unsigned int i;
+
+    for(i = 0; i < count; i++, index++){
+        unsigned int sample = samples[i];
+        sum        += sample;
+        sumSquares += sample*sample;                        // 28 bits, no overflow before add
+        if(sample < min) min = sample;
+        if(sample > max) max = sample;
+        if(stats->high){
+            if(sample < lower){
+                stats->high = 0;
+            }
+        }else if(sample > upper){                           // Rising crossing
+            stats->high = 1;
+            if(0 == stats->rises){
+                stats->firstRise = index;
+            }
+            stats->lastRise = index;
+            stats->rises++;
+        }
+    }
+    stats->sum        = sum;
+    stats->sumSquares = sumSquares;
+    stats->min        = min;
+    stats->max        = max;
+    stats->count      = index;
+}
+
+/* result_Statistics()
+ *  Finishes a window and starts the next with its mean as threshold
+ *
+ * Parameters:
+ *  stats  - Window in progress, cleared after
+ *  rate   - Sample rate in Hz for frequency
+ *  result - Filled with window results, all 0 if window was empty
+ */
+void result_Statistics(Statistics * stats, unsigned int rate, StatResult * result){
+    unsigned long long meanSquare, mean;
+    if(0 == stats->count){
+        result->count = result->min = result->max = result->peakToPeak = 0;
+        result->mean = result->rms = result->acRms = result->centiHz = 0;
+        return;
+    }
+    mean       = stats->sum/stats->count;
+    meanSquare = stats->sumSquares/stats->count;
+
+    result->count      = stats->count;
+    result->min        = stats->min;
+    result->max        = stats->max;
+    result->peakToPeak = stats->max - stats->min;
+    result->mean       = (unsigned int)mean;
+    result->rms        = sqrt64_Fixed(meanSquare);
+    if(stats->count <= STATS_EXACT_COUNT){
+        //Variance from the same sums, n*sum(x^2) - sum(x)^2 keeps full precision
+        result->acRms  = sqrt64_Fixed((stats->count*stats->sumSquares - stats->sum*stats->sum)/
+                                     ((unsigned long long)stats->count*stats->count));
+    }else{                                                  // Products would overflow 64 bits
+        result->acRms  = sqrt64_Fixed(meanSquare > mean*mean ? meanSquare - mean*mean : 0);
+    }
+    result->centiHz    = 0;
+    if(stats->rises > 1 && stats->lastRise > stats->firstRise){
+        result->centiHz = (unsigned int)(((unsigned long long)(stats->rises - 1)*rate*100)/
+                                         (stats->lastRise - stats->firstRise));
+    }
+
+    //Next window crosses this mean with hysteresis from this swing
+    stats->threshold  = result->mean;
+    stats->hysteresis = result->peakToPeak/8 > STATS_MIN_HYSTERESIS ?
+                        result->peakToPeak/8 : STATS_MIN_HYSTERESIS;
+    clear_Window(stats);
+}
+
+static void clear_Window(Statistics * stats){
+    stats->count      = 0;
+    stats->sum        = 0;
+    stats->sumSquares = 0;
+    stats->min        = 0xFFFFFFFF;
+    stats->max        = 0;
+    stats->rises      = 0;
+    stats->firstRise  = 0;
+    stats->lastRise   = 0;
+}
@@ -0,0 +1,70 @@
+/*
+ * Statistics.h
+ *
+ *   This libary holds a streaming statistics stage for ADC blocks
+ *      init_Statistics   - Clears a window, threshold starts at mid scale
+ *      update_Statistics - Adds a run of samples to the window
+ *      result_Statistics - Finishes window, fills results and starts next one
+ *
+ *   Per sample work is adds, one multiply and compares. Sums are 64 bit so
+ *   windows of any practical length cannot overflow, the only divides and
+ *   the square root run once per window in result_Statistics.
+ *
+ *   Frequency counts rising crossings of the previous window mean with
+ *   hysteresis of 1/8 the previous peak to peak, so noise near the mean is
+ *   not counted. Frequency is crossings over the time between the first and
+ *   last crossing, 0 when fewer than two were seen.
+ *
+ * Depenedencies:
+ *   Fixed_Math.h - Integer square root
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *   Oct 19, 2026 - Uses Fixed_Math
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef STATISTICS_H_
+#define STATISTICS_H_
+
+#define STATS_MID_SCALE     8192        // First window threshold, 14 bit mid scale
+#define STATS_MIN_HYSTERESIS 16         // Counts, floor for quiet signals
+#define STATS_EXACT_COUNT   (1u << 18)  // Longer windows lose AC RMS precision
+
+//Data struct for a window in progress
+typedef struct{
+    unsigned int       count;           // Samples in window
+    unsigned long long sum;
+    unsigned long long sumSquares;
+    unsigned int       min;
+    unsigned int       max;
+    unsigned int       threshold;       // Crossing level, last window mean
+    unsigned int       hysteresis;
+    int                high;            // Above threshold band
+    unsigned int       rises;           // Rising crossings in window
+    unsigned int       firstRise;       // Sample index of first and last rise
+    unsigned int       lastRise;
+}Statistics;
+
+//Data struct for one finished window, raw ADC counts
+typedef struct{
+    unsigned int count;
+    unsigned int min;
+    unsigned int max;
+    unsigned int peakToPeak;
+    unsigned int mean;
+    unsigned int rms;                   // Square root of mean square
+    unsigned int acRms;                 // Standard deviation, RMS with mean removed
+    unsigned int centiHz;               // Frequency in 0.01 Hz
+}StatResult;
+
+void init_Statistics(Statistics * stats);
+void update_Statistics(Statistics * stats, const unsigned short * samples, unsigned int count);
+void result_Statistics(Statistics * stats, unsigned int rate, StatResult * result);
+
+#endif /* STATISTICS_H_ */
@@ -0,0 +1,297 @@
+/*
+ *  Stream.c
+ *    This holds the framing, CRC and COBS encoding for binary streaming
+ *    See Stream.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *   Oct 19, 2026 - Frames queued with write_Whole_UART
+ *   Oct 19, 2026 - Spectrum frames added
+ *   Oct 19, 2026 - Triggered capture frames, shared sample packing
+ *   Oct 19, 2026 - Profile probe around frame encoding
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Stream.h"
+#include "Profile.h"
+
+#define FRAME_OVERHEAD  5                               // Type, sequence, CRC
+#define FRAME_LENGTH    (STREAM_MAX_PAYLOAD + FRAME_OVERHEAD)
+#define ENCODED_LENGTH  (FRAME_LENGTH + FRAME_LENGTH/254 + 2)
+
+#if STREAM_SAMPLE_PAYLOAD > STREAM_MAX_PAYLOAD || STREAM_CAPTURE_PAYLOAD > STREAM_MAX_PAYLOAD
+#error "STREAM_MAX_PAYLOAD must hold every payload type"
+#endif
+
+static unsigned int sequence;                           // Counts every frame
+static unsigned int dropped;                            // Frames that did not fit
+
+static unsigned int pack_Samples(const unsigned short * samples, unsigned int count,
+                                 unsigned char * output);
+
+//CRC16 CCITT lookup, one entry per byte value
+static const unsigned short crcTable[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+/* crc_Stream()
+ *  CRC16 CCITT over a block, one table lookup per byte
+ */
+static unsigned short crc_Stream(const unsigned char * data, unsigned int length){
+    unsigned short crc = 0xFFFF;
+    while(length--){
+        crc = (crc << 8) ^ crcTable[(crc >> 8) ^ *data++];
+    }
+    return crc;
+}
+
+/* encode_COBS()
+ *  Encodes a block so it contains no zero bytes and adds the 0x00 delimiter
+ *
+ * Returns:
+ *  Length of encoded block including delimiter
+ */
+static unsigned int encode_COBS(const unsigned char * input, unsigned int length,
+                                unsigned char * output){
+    unsigned int code  = 0;                             // Index of current code byte
+    unsigned int index = 1;                             // Next output byte
+    unsigned char run  = 1;                             // Code value so far
+    unsigned int i;
+
+    for(i = 0; i < length; i++){
+        if(0 == input[i]){                              // Zero ends a run
+            output[code] = run;
+            code  = index++;
+            run   = 1;
+        }else{
+            output[index++] = input[i];
+            run++;
+            if(0xFF == run){                            // Longest run, start a new one
+                output[code] = run;
+                code  = index++;
+                run   = 1;
+            }
+        }
+    }
+    output[code]    = run;
+    output[index++] = 0;                                // Frame delimiter
+    return index;
+}
+
+/* send_Frame_Stream()
+ *  Adds header and CRC, encodes and queues frame. Frame is only queued if it
+ *  fits whole, otherwise it is counted as dropped.
+ *
+ * Parameters:
+ *  type    - Frame type
+ *  payload - Frame payload
+ *  length  - Payload length, at most STREAM_MAX_PAYLOAD
+ *
+ * Returns:
+ *  1 - Frame queued
+ *  0 - Frame dropped
+ */
+int send_Frame_Stream(unsigned char type, const unsigned char * payload, unsigned int length){
+    static unsigned char frame[ FRAME_LENGTH ];
+    static unsigned char encoded[ ENCODED_LENGTH ];
+    unsigned short crc;
+    unsigned int size;
+    int queued;
+    PROFILE_START(PROBE_FRAME);
+
+    if(length > STREAM_MAX_PAYLOAD){
+        return 0;
+    }
+    frame[0] = type;
+    frame[1] = sequence & 0xFF;
+    frame[2] = (sequence >> 8) & 0xFF;
+    sequence++;                                         // Dropped frames still use a number
+    memcpy(&frame[3], payload, length);
+    crc = crc_Stream(frame, length + 3);
+    frame[length + 3] = crc & 0xFF;
+    frame[length + 4] = crc >> 8;
+
+    size = encode_COBS(frame, length + FRAME_OVERHEAD, encoded);
+    queued = write_Whole_UART((const char *)encoded, size);  // Partial frames are useless to host
+    PROFILE_STOP(PROBE_FRAME);
+    if(!queued){
+        dropped++;
+        return 0;
+    }
+    return 1;
+}
+
+/* send_Samples_Stream()
+ *  Packs 14 bit samples LSB first and sends them as one STREAM_TYPE_ADC frame
+ *
+ * Parameters:
+ *  samples      - Raw ADC results, upper two bits ignored
+ *  count        - Number of samples, at most STREAM_MAX_SAMPLES
+ *  hasTimestamp - Non zero to include timestamp
+ *  timestamp    - Time of first sample, units chosen by caller
+ *
+ * Returns:
+ *  1 - Frame queued
+ *  0 - Frame dropped
+ */
+int send_Samples_Stream(const unsigned short * samples, unsigned int count,
+                        int hasTimestamp, unsigned int timestamp){
+    static unsigned char payload[ STREAM_SAMPLE_PAYLOAD ];
+    unsigned int index = 0;
+
+    if(count > STREAM_MAX_SAMPLES){
+        count = STREAM_MAX_SAMPLES;
+    }
+    payload[index++] = hasTimestamp ? STREAM_FLAG_TIMESTAMP : 0;
+    if(hasTimestamp){
+        payload[index++] = timestamp & 0xFF;
+        payload[index++] = (timestamp >> 8) & 0xFF;
+        payload[index++] = (timestamp >> 16) & 0xFF;
+        payload[index++] = timestamp >> 24;
+    }
+    payload[index++] = count & 0xFF;
+    payload[index++] = count >> 8;
+    index += pack_Samples(samples, count, &payload[index]);
+    return send_Frame_Stream(STREAM_TYPE_ADC, payload, index);
+}
+
+/* send_Spectrum_Stream()
+ *  Sends magnitude bins as one STREAM_TYPE_SPECTRUM frame
+ *
+ * Parameters:
+ *  bins   - Magnitudes, bin 0 is DC
+ *  count  - Number of bins, at most STREAM_MAX_BINS
+ *  size   - FFT points, sets bin spacing with rate
+ *  rate   - Sample rate in Hz
+ *  cycles - CPU cycles the FFT took
+ *
+ * Returns:
+ *  1 - Frame queued
+ *  0 - Frame dropped
+ */
+int send_Spectrum_Stream(const unsigned short * bins, unsigned int count,
+                         unsigned int size, unsigned int rate, unsigned int cycles){
+    static unsigned char payload[ STREAM_SPECTRUM_PAYLOAD ];
+    unsigned int index = 0;
+    unsigned int i;
+
+    if(count > STREAM_MAX_BINS){
+        count = STREAM_MAX_BINS;
+    }
+    payload[index++] = size & 0xFF;
+    payload[index++] = size >> 8;
+    for(i = 0; i < 32; i += 8){
+        payload[index++] = (rate >> i) & 0xFF;
+    }
+    for(i = 0; i < 32; i += 8){
+        payload[index++] = (cycles >> i) & 0xFF;
+    }
+    payload[index++] = count & 0xFF;
+    payload[index++] = count >> 8;
+    for(i = 0; i < count; i++){
+        payload[index++] = bins[i] & 0xFF;
+        payload[index++] = bins[i] >> 8;
+    }
+    return send_Frame_Stream(STREAM_TYPE_SPECTRUM, payload, index);
+}
+
+/* send_Capture_Stream()
+ *  Sends a triggered capture as one STREAM_TYPE_CAPTURE frame
+ *
+ * Parameters:
+ *  samples  - Raw ADC results, oldest first
+ *  count    - Number of samples, at most STREAM_MAX_CAPTURE
+ *  trigger  - Index in samples of the first sample past the trigger level
+ *  position - Sample number of that sample since sampling started
+ *  flags    - STREAM_FLAG_FALLING for a falling edge
+ *
+ * Returns:
+ *  1 - Frame queued
+ *  0 - Frame dropped
+ */
+int send_Capture_Stream(const unsigned short * samples, unsigned int count,
+                        unsigned int trigger, unsigned int position, unsigned char flags){
+    static unsigned char payload[ STREAM_CAPTURE_PAYLOAD ];
+    unsigned int index = 0;
+    unsigned int i;
+
+    if(count > STREAM_MAX_CAPTURE){
+        count = STREAM_MAX_CAPTURE;
+    }
+    payload[index++] = flags;
+    for(i = 0; i < 32; i += 8){
+        payload[index++] = (position >> i) & 0xFF;
+    }
+    payload[index++] = trigger & 0xFF;
+    payload[index++] = trigger >> 8;
+    payload[index++] = count & 0xFF;
+    payload[index++] = count >> 8;
+    index += pack_Samples(samples, count, &payload[index]);
+    return send_Frame_Stream(STREAM_TYPE_CAPTURE, payload, index);
+}
+
+unsigned int dropped_Stream(void){
+    return dropped;
+}
+
+/* pack_Samples()
+ *  Packs 14 bit samples LSB first, 4 samples per 7 bytes
+ *
+ * Returns:
+ *  Bytes written
+ */
+static unsigned int pack_Samples(const unsigned short * samples, unsigned int count,
+                                 unsigned char * output){
+    unsigned int index = 0;
+    unsigned int bits = 0;                              // Bits waiting in accumulator
+    unsigned int accumulator = 0;
+    unsigned int i;
+
+    for(i = 0; i < count; i++){
+        accumulator |= (samples[i] & 0x3FFF) << bits;   // Append 14 bits
+        bits += 14;
+        while(bits >= 8){                               // Emit whole bytes
+            output[index++] = accumulator & 0xFF;
+            accumulator >>= 8;
+            bits -= 8;
+        }
+    }
+    if(bits){                                           // Last partial byte
+        output[index++] = accumulator & 0xFF;
+    }
+    return index;
+}
@@ -0,0 +1,78 @@
+/*
+ * Stream.h
+ *
+ *   This libary holds functions for binary framed streaming over UART
+ *      send_Frame_Stream   - Sends any payload as a framed packet
+ *      send_Samples_Stream - Packs 14 bit ADC samples and sends them
+ *      send_Spectrum_Stream - Sends FFT magnitude bins with rate and cost
+ *      send_Capture_Stream  - Sends a triggered capture with its trigger point
+ *      dropped_Stream      - Returns frames dropped because TX buffer was full
+ *
+ *   Frame before encoding:
+ *      type (1) | sequence (2) | payload (n) | CRC16 (2)
+ *   Multi-byte values are little endian, CRC16 is CCITT (poly 0x1021,
+ *   init 0xFFFF) over type through payload. Frame is COBS encoded and ends
+ *   with a 0x00 delimiter so the host can resync after any lost byte.
+ *   Sequence counts every frame, sent or dropped, so gaps show drops.
+ *
+ *   Sample payload (STREAM_TYPE_ADC):
+ *      flags (1) | timestamp (4, if STREAM_FLAG_TIMESTAMP) | count (2) |
+ *      samples packed LSB first, 14 bits each, 4 samples per 7 bytes
+ *
+ *   Spectrum payload (STREAM_TYPE_SPECTRUM):
+ *      size (2, FFT points) | rate (4, Hz) | cycles (4, FFT cost) |
+ *      count (2) | bins (2 each), bin n is n*rate/size Hz
+ *
+ *   Capture payload (STREAM_TYPE_CAPTURE):
+ *      flags (1) | position (4, sample number of trigger) |
+ *      trigger (2, index of trigger sample) | count (2) | samples packed as
+ *      in the sample payload
+ *
+ * Depenedencies:
+ *   UART.h - Frames are queued whole on the TX buffer or not at all
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *   Oct 19, 2026 - Spectrum frames added
+ *   Oct 19, 2026 - Triggered capture frames added
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef STREAM_H_
+#define STREAM_H_
+#include "UART.h"
+
+#define STREAM_MAX_SAMPLES      256     // Largest block for send_Samples_Stream
+#define STREAM_MAX_BINS         512     // Largest spectrum for send_Spectrum_Stream
+#define STREAM_MAX_CAPTURE      512     // Largest capture for send_Capture_Stream
+#define STREAM_SAMPLE_PAYLOAD   (7 + (STREAM_MAX_SAMPLES*14 + 7)/8)
+#define STREAM_SPECTRUM_PAYLOAD (12 + STREAM_MAX_BINS*2)
+#define STREAM_CAPTURE_PAYLOAD  (9 + (STREAM_MAX_CAPTURE*14 + 7)/8)
+#define STREAM_MAX_PAYLOAD      STREAM_SPECTRUM_PAYLOAD // Largest of the above, checked in Stream.c
+
+//Frame types
+#define STREAM_TYPE_ADC         0x01
+#define STREAM_TYPE_SPECTRUM    0x02
+#define STREAM_TYPE_CAPTURE     0x03
+
+//Sample payload flags
+#define STREAM_FLAG_TIMESTAMP   0x01
+
+//Capture payload flags
+#define STREAM_FLAG_FALLING     0x01    // Trigger was a falling edge
+
+int  send_Frame_Stream(unsigned char type, const unsigned char * payload, unsigned int length);
+int  send_Samples_Stream(const unsigned short * samples, unsigned int count,
+                         int hasTimestamp, unsigned int timestamp);
+int  send_Spectrum_Stream(const unsigned short * bins, unsigned int count,
+                          unsigned int size, unsigned int rate, unsigned int cycles);
+int  send_Capture_Stream(const unsigned short * samples, unsigned int count,
+                         unsigned int trigger, unsigned int position, unsigned char flags);
+unsigned int dropped_Stream(void);
+
+#endif /* STREAM_H_ */
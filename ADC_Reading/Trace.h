@@ -0,0 +1,97 @@
+/*
+ * Trace.h
+ *
+ *   This libary marks interrupts and tasks on GPIO pins for a logic analyzer
+ *      init_Trace  - Makes the trace pins outputs, low
+ *      TRACE_ENTER - Marks the start of a traced section
+ *      TRACE_EXIT  - Marks the end of it
+ *
+ *   TRACE_MODE picks the build:
+ *      TRACE_OFF     - Macros are empty, nothing is compiled in
+ *      TRACE_PINS    - Each source has its own pin, TRACE_PORT bit = source.
+ *                      Enter and exit are one store to the pin's bit-band
+ *                      alias, so an ISR never undoes another's pin.
+ *      TRACE_ENCODED - Source + 1 is written to TRACE_PORT on enter and the
+ *                      value before it put back on exit, so nested ISRs
+ *                      show as the inner code then the outer again. Three
+ *                      pins show seven sources, 0 is idle. The whole port
+ *                      is written, keep nothing else on it.
+ *
+ *   Set TRACE_MODE here or with -DTRACE_MODE=1 on the build. TRACE_ENTER
+ *   declares a variable in TRACE_ENCODED, so it goes last in a block's
+ *   declarations with TRACE_EXIT later in the same block. A section
+ *   with more than one return needs TRACE_EXIT before each.
+ *
+ *   TRACE_PORT is P2, P2.0-P2.2 are also the LaunchPad RGB LED so the
+ *   encoded source shows as a colour.
+ *
+ * Depenedencies:
+ *   msp.h - Port registers and BITBAND_PERI
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+#include "msp.h"
+
+#define TRACE_OFF       0
+#define TRACE_PINS      1
+#define TRACE_ENCODED   2
+
+#ifndef TRACE_MODE
+#define TRACE_MODE      TRACE_OFF
+#endif
+#define TRACE_PORT      P2
+
+//Sources, pin number in TRACE_PINS, code - 1 in TRACE_ENCODED
+#define TRACE_TA0       0
+#define TRACE_TA1       1
+#define TRACE_TA2       2
+#define TRACE_PORT4     3
+#define TRACE_EUSCIA0   4
+#define TRACE_ADC14     5
+#define TRACE_DMA       6
+#define TRACE_SOURCES   7
+
+#if TRACE_MODE == TRACE_PINS
+
+#define TRACE_MASK      ((1 << TRACE_SOURCES) - 1)
+#define TRACE_ENTER(source)     (BITBAND_PERI(TRACE_PORT->OUT, (source)) = 1)
+#define TRACE_EXIT(source)      (BITBAND_PERI(TRACE_PORT->OUT, (source)) = 0)
+
+#elif TRACE_MODE == TRACE_ENCODED
+
+#define TRACE_MASK      0x07            // Codes 1 to TRACE_SOURCES
+#define TRACE_ENTER(source)     unsigned char traceSaved_##source = TRACE_PORT->OUT; \
+                                TRACE_PORT->OUT = (source) + 1
+#define TRACE_EXIT(source)      (TRACE_PORT->OUT = traceSaved_##source)
+
+#else
+
+#define TRACE_MASK      0
+#define TRACE_ENTER(source)
+#define TRACE_EXIT(source)
+
+#endif
+
+/* init_Trace()
+ *  Call before interrupts are enabled, does nothing with TRACE_OFF
+ */
+static inline void init_Trace(void){
+#if TRACE_MODE != TRACE_OFF
+    TRACE_PORT->SEL0 &= ~TRACE_MASK;
+    TRACE_PORT->SEL1 &= ~TRACE_MASK;
+    TRACE_PORT->OUT  &= ~TRACE_MASK;
+    TRACE_PORT->DIR  |=  TRACE_MASK;
+#endif
+}
+
+#endif /* TRACE_H_ */
@@ -10,71 +10,130 @@
  *   May 5,  2017 - Initial Creation
  *   May 10, 2017 - Modified to work with assignment 8
  *   May 12, 2017 - Cleaned and commented
+ *   Oct 19, 2026 - TX moved onto power-of-two ring buffer with overflow count
+ *   Oct 19, 2026 - DMA transmit mode, one interrupt per ring segment
+ *   Oct 19, 2026 - Float divider and BRS if-chain replaced by integer search
+ *   Oct 19, 2026 - High speed limits checked, init_UART reports bad baud
+ *   Oct 19, 2026 - write_UART added for binary frames
+ *   Oct 19, 2026 - Producers made interrupt safe, write_Whole_UART added
+ *   Oct 19, 2026 - RX ring and line reader ported from assignment 7
+ *   Oct 19, 2026 - Trace marks on ISRs
  *
  *  Author: Drew Hartley, Jordan Jones
  */
 #include "UART.h"
+#include "Trace.h"
 
-static volatile char TX_BUFFER[ UART_BUFFER_LENGTH ];
-static volatile unsigned int TX_WRITE_INDEX;
-static volatile unsigned int TX_LOAD_INDEX;
+static char TX_DATA[ UART_BUFFER_LENGTH ];
+static RingBuffer TX_BUFFER;
+static volatile int txRunning;                              // Set while TX interrupt is draining ring
+#if UART_TX_DMA
+static volatile unsigned int txSegment;                     // Bytes owned by running DMA cycle
+#endif
 
-void init_UART(unsigned int baud){
+static char RX_DATA[ UART_RX_LENGTH ];
+static RingBuffer RX_BUFFER;
+static volatile unsigned int rxOverrun;                     // Bytes lost in hardware before ISR ran
+static int rxEcho = 1;                                      // Echo line characters back
+
+static BaudConfig activeBaud;                               // Divider currently in use
+
+static void start_TX_UART(void);
+
+/* calculate_Baud_UART()
+ *  Finds BRW/BRF/BRS for a clock and baud using integer math only.
+ *  BRW and BRF come straight from the divider (UART_BRW/UART_BRF), BRS is
+ *  picked by trying all 256 patterns and keeping the one with the smallest
+ *  worst case TX bit timing error over a 10 bit frame (start, 8 data, stop).
+ *
+ * Parameters:
+ *  clock  - BRCLK frequency in Hz
+ *  baud   - Desired baud rate
+ *  config - Filled with register values, achieved baud and error
+ *
+ * Errors:
+ *  None Currently - Oct 19, 2026
+ */
+void calculate_Baud_UART(unsigned long clock, unsigned long baud, BaudConfig * config){
+    unsigned int bitCycles = UART_OS16(clock, baud) ?           // BRCLK cycles per bit before BRS
+                             16*UART_BRW(clock, baud) + UART_BRF(clock, baud) :
+                             UART_BRW(clock, baud);
+    long long bestError = -1;
+    long long bestSigned = 0;
+    unsigned int bestPattern = 0;
+    unsigned int pattern, bit;
+
+    for(pattern = 0; pattern < 256; pattern++){
+        long long worst = 0, worstSigned = 0;
+        unsigned long long cycles = 0;
+        for(bit = 0; bit < UART_FRAME_BITS; bit++){
+            long long error;
+            cycles += bitCycles + ((pattern >> (bit & 7)) & 1); // BRS bit 0 applies to start bit
+            //Error in BRCLK cycles scaled by baud, divide by clock for fraction of a bit
+            error = (long long)(cycles*baud) - (long long)(bit + 1)*clock;
+            if((error < 0 ? -error : error) > worst){
+                worst = error < 0 ? -error : error;
+                worstSigned = error;
+            }
+        }
+        if(bestError < 0 || worst < bestError){             // Keep smallest worst case
+            bestError   = worst;
+            bestSigned  = worstSigned;
+            bestPattern = pattern;
+        }
+    }
+
+    config->brw   = UART_BRW(clock, baud);
+    config->mctlw = (bestPattern << EUSCI_A_MCTLW_BRS_OFS) |
+                    (UART_BRF(clock, baud) << EUSCI_A_MCTLW_BRF_OFS) |
+                    (UART_OS16(clock, baud) ? EUSCI_A_MCTLW_OS16 : 0);
+    config->error = (int)((bestSigned*10000)/(long long)clock); // 0.01% of a bit
+    {
+        unsigned int ones = 0;                              // Average cycles per bit over 8 bit pattern
+        for(bit = 0; bit < 8; bit++){
+            ones += (bestPattern >> bit) & 1;
+        }
+        config->baud = (unsigned long)(((unsigned long long)clock*8)/(8*bitCycles + ones));
+    }
+}
+
+unsigned long get_Baud_UART(void){
+    return activeBaud.baud;                                 // Baud actually generated
+}
+
+int get_Baud_Error_UART(void){
+    return activeBaud.error;                                // Worst bit error, 0.01% units
+}
+
+/* init_UART()
+ *  Starts UART at a given baud from SMCLK = F_CPU
+ *
+ * Returns:
+ *  0  - No Error
+ *  -1 - Baud outside UART_MIN_BAUD to UART_MAX_BAUD or bit error above
+ *       UART_MAX_ERROR, UART left off
+ */
+int init_UART(unsigned int baud){
+    BaudConfig config;
+
+    if(UART_MIN_BAUD > baud || UART_MAX_BAUD < baud){       // 16 BRCLK per bit, BRW fits 16 bits
+        return -1;
+    }
+    calculate_Baud_UART(F_CPU, baud, &config);
+    if(UART_MAX_ERROR < config.error || -UART_MAX_ERROR > config.error){
+        return -1;                                          // Receiver would mis-sample
+    }
 
     EUSCI_A0->CTLW0 |= EUSCI_A_CTLW0_SWRST; // Reset USCI
+    init_Ring(&TX_BUFFER, TX_DATA, UART_BUFFER_LENGTH);
+    init_Ring(&RX_BUFFER, RX_DATA, UART_RX_LENGTH);
+    txRunning = 0;
+    rxOverrun = 0;
 
-    //Calculate float for divider, get first two decimal places
-    float n = F_CPU/baud;
-    int nFractional = (unsigned int)((n - (unsigned int) n)*100);
-
-    if(n <=16){//No over-sampling see technical reference
-        EUSCI_A0->MCTLW  = 0x00;
-        EUSCI_A0->BRW = (unsigned int)n;
-
-    }else{
-        //Over-sampling required see technical reference
-        EUSCI_A0->MCTLW  =  EUSCI_A_MCTLW_OS16;
-        EUSCI_A0->BRW    = (unsigned int)(n/16);
-        EUSCI_A0->MCTLW |= ((unsigned int)(((n/16) -((unsigned int)(n/16)))*16))
-                                        << EUSCI_A_MCTLW_BRF_OFS;
-    }
-    //Fractional lookup table, no better way to implement
-    if(5 >= nFractional)       EUSCI_A0->MCTLW |= 0x0000;
-    else if( 7 >= nFractional) EUSCI_A0->MCTLW |= 0x0100;
-    else if( 8 >= nFractional) EUSCI_A0->MCTLW |= 0x0200;
-    else if(10 >= nFractional) EUSCI_A0->MCTLW |= 0x0400;
-    else if(12 >= nFractional) EUSCI_A0->MCTLW |= 0x0800;
-    else if(14 >= nFractional) EUSCI_A0->MCTLW |= 0x1000;
-    else if(16 >= nFractional) EUSCI_A0->MCTLW |= 0x2000;
-    else if(21 >= nFractional) EUSCI_A0->MCTLW |= 0x1100;
-    else if(22 >= nFractional) EUSCI_A0->MCTLW |= 0x2100;
-    else if(25 >= nFractional) EUSCI_A0->MCTLW |= 0x2200;
-    else if(30 >= nFractional) EUSCI_A0->MCTLW |= 0x4400;
-    else if(33 >= nFractional) EUSCI_A0->MCTLW |= 0x2500;
-    else if(35 >= nFractional) EUSCI_A0->MCTLW |= 0x4900;
-    else if(37 >= nFractional) EUSCI_A0->MCTLW |= 0x4A00;
-    else if(40 >= nFractional) EUSCI_A0->MCTLW |= 0x5200;
-    else if(42 >= nFractional) EUSCI_A0->MCTLW |= 0x9200;
-    else if(43 >= nFractional) EUSCI_A0->MCTLW |= 0x5300;
-    else if(50 >= nFractional) EUSCI_A0->MCTLW |= 0x5500;
-    else if(57 >= nFractional) EUSCI_A0->MCTLW |= 0xAA00;
-    else if(60 >= nFractional) EUSCI_A0->MCTLW |= 0x6B00;
-    else if(62 >= nFractional) EUSCI_A0->MCTLW |= 0xAD00;
-    else if(64 >= nFractional) EUSCI_A0->MCTLW |= 0xB500;
-    else if(66 >= nFractional) EUSCI_A0->MCTLW |= 0xB600;
-    else if(70 >= nFractional) EUSCI_A0->MCTLW |= 0xD600;
-    else if(71 >= nFractional) EUSCI_A0->MCTLW |= 0xB700;
-    else if(75 >= nFractional) EUSCI_A0->MCTLW |= 0xBB00;
-    else if(78 >= nFractional) EUSCI_A0->MCTLW |= 0xDD00;
-    else if(80 >= nFractional) EUSCI_A0->MCTLW |= 0xED00;
-    else if(83 >= nFractional) EUSCI_A0->MCTLW |= 0xEE00;
-    else if(84 >= nFractional) EUSCI_A0->MCTLW |= 0xBF00;
-    else if(85 >= nFractional) EUSCI_A0->MCTLW |= 0xDF00;
-    else if(87 >= nFractional) EUSCI_A0->MCTLW |= 0xEF00;
-    else if(90 >= nFractional) EUSCI_A0->MCTLW |= 0xF700;
-    else if(91 >= nFractional) EUSCI_A0->MCTLW |= 0xFB00;
-    else if(92 >= nFractional) EUSCI_A0->MCTLW |= 0xFD00;
-    else                       EUSCI_A0->MCTLW |= 0xFE00;
+    //Integer divider and modulation search, see calculate_Baud_UART
+    activeBaud = config;
+    EUSCI_A0->BRW   = activeBaud.brw;
+    EUSCI_A0->MCTLW = activeBaud.mctlw;
 
     //Select MCLK
     EUSCI_A0->CTLW0 |= EUSCI_A_CTLW0_SSEL__SMCLK;
@@ -87,63 +146,285 @@ void init_UART(unsigned int baud){
 
     //Enable interupts
     EUSCI_A0->IFG   = 0;
-    EUSCI_A0->IE |= EUSCI_A_IE_TXCPTIE ;                    // Only enable TX complete interrupt
+#if UART_TX_DMA
+    //TX interrupt not used, DMA is triggered by TXIFG and interrupts per segment
+    EUSCI_A0->IFG  |= EUSCI_A_IFG_TXIFG;                    // TXBUF is empty after reset
+    EUSCI_A0->IE   |= EUSCI_A_IE_RXIE;
+    config_Channel_DMA(UART_DMA_CHANNEL, UART_DMA_SOURCE);
+    DMA_Channel->INT1_SRCCFG = DMA_INT1_SRCCFG_EN | UART_DMA_CHANNEL;
+    NVIC->ISER[1] = 1 << ((DMA_INT1_IRQn) & 31);
+#else
+    EUSCI_A0->IE   |= EUSCI_A_IE_TXCPTIE | EUSCI_A_IE_RXIE;
+#endif
     NVIC->ISER[0] = 1 << ((EUSCIA0_IRQn) & 31);
+    return 0;
+}
 
+#if UART_TX_DMA
+/* start_TX_UART()
+ *  Hands next contiguous ring segment to DMA if no segment is running.
+ *  Segment stays in the ring until its DMA cycle completes.
+ */
+static void start_TX_UART(void){
+    const char * data;
+    unsigned int length;
+    if(txRunning){                                          // DMA still owns a segment
+        return;
+    }
+    length = peek_Ring(&TX_BUFFER, &data);                  // Bytes up to storage wrap
+    if(0 == length){
+        return;
+    }
+    if(length > DMA_MAX_TRANSFERS){                         // One DMA cycle at most
+        length = DMA_MAX_TRANSFERS;
+    }
+    txSegment = length;
+    txRunning = 1;
 
+    DMA_TABLE[UART_DMA_CHANNEL].srcEnd  = (volatile void *)&data[length - 1];
+    DMA_TABLE[UART_DMA_CHANNEL].dstEnd  = (volatile void *)&EUSCI_A0->TXBUF;
+    DMA_TABLE[UART_DMA_CHANNEL].control = DMA_CW_DST_INC_NONE  | DMA_CW_DST_SIZE_BYTE |
+                                          DMA_CW_SRC_INC_BYTE  | DMA_CW_SRC_SIZE_BYTE |
+                                          DMA_CW_ARB_1         | DMA_CW_N(length)     |
+                                          DMA_CW_MODE_BASIC;
+    if(EUSCI_A0->IFG & EUSCI_A_IFG_TXIFG){                  // TXBUF empty, no edge will come
+        EUSCI_A0->IFG &= ~EUSCI_A_IFG_TXIFG;                // Clear so setting it makes the trigger
+        DMA_Control->ENASET = 1 << UART_DMA_CHANNEL;
+        EUSCI_A0->IFG |=  EUSCI_A_IFG_TXIFG;                // Trigger first transfer
+    }else{                                                  // Byte still in TXBUF
+        DMA_Control->ENASET = 1 << UART_DMA_CHANNEL;        // Trigger comes when it moves out
+    }
 }
 
-void print_Char_UART(char data){
-    int compareIndex  = TX_LOAD_INDEX == TX_WRITE_INDEX;    // Check if indexes are equal
-    TX_BUFFER[TX_LOAD_INDEX] = data;                        // Load data to buffer
-    TX_LOAD_INDEX = (TX_LOAD_INDEX + 1)% UART_BUFFER_LENGTH;// Increment buffer with rollover
-    if(compareIndex){                                       // If index was equal (interrupt disabled)
-        EUSCI_A0->TXBUF = TX_BUFFER[TX_WRITE_INDEX];        // Send char to UART buffer
+/* DMA_INT1_IRQHandler()
+ *  Runs once per finished segment, frees it and starts the next one
+ */
+void DMA_INT1_IRQHandler(void){
+    TRACE_ENTER(TRACE_DMA);
+    DMA_Channel->INT0_CLRFLG = 1 << UART_DMA_CHANNEL;       // Clear flag
+    skip_Ring(&TX_BUFFER, txSegment);                       // Segment is now in the UART
+    txSegment = 0;
+    txRunning = 0;
+    start_TX_UART();                                        // Send anything queued meanwhile
+    TRACE_EXIT(TRACE_DMA);
+}
+#else
+/* start_TX_UART()
+ *  Loads first byte and enables TX complete interrupt if ISR is idle.
+ *  ISR only goes idle once ring is empty, so this never races it.
+ */
+static void start_TX_UART(void){
+    char data;
+    if(!txRunning && get_Ring(&TX_BUFFER, &data)){          // Idle and data waiting
+        txRunning = 1;                                      // ISR now owns the ring tail
         EUSCI_A0->IFG  &= ~EUSCI_A_IFG_TXCPTIFG;            // Clear interrupt flag
+        EUSCI_A0->TXBUF = data;                             // Send char to UART buffer
         EUSCI_A0->IE   |= EUSCI_A_IE_TXCPTIE;               // Enable TX complete interrupt
     }
 }
+#endif
 
-void print_String_UART(const char* data){
-    int i, length, compareIndex;
-    length = strlen(data);                                  // Check length of the string
-    compareIndex = TX_LOAD_INDEX == TX_WRITE_INDEX;         // Check if indexes are equal
-    for(i = 0; i<length; i++){                              // Loop through full string
-        TX_BUFFER[TX_LOAD_INDEX] = data[i];                 // Add char from string to buffer
-        TX_LOAD_INDEX = (TX_LOAD_INDEX +1)                  // Increment index with rollover
-                      % UART_BUFFER_LENGTH;
-    }
-    
-    if(compareIndex){                                       // If index was equal (interrupt disabled)
-        EUSCI_A0->TXBUF = TX_BUFFER[TX_WRITE_INDEX];        // Send a char to UART buffer
-        EUSCI_A0->IFG  &= ~EUSCI_A_IFG_TXCPTIFG;            // Clear interrupt flag
-        EUSCI_A0->IE   |= EUSCI_A_IE_TXCPTIE;               // Enable TX complete interrupt
-    }
+//Producers may run in ISRs (see Log.h), so each queue is done with
+//interrupts masked and whatever mask state the caller had is restored
+int print_Char_UART(char data){
+    unsigned int state = __get_PRIMASK();
+    int added;
+    __disable_irq();
+    added = put_Ring(&TX_BUFFER, data);                     // Load data, dropped if full
+    start_TX_UART();                                        // Kick ISR if it was idle
+    __set_PRIMASK(state);
+    return added;
+}
+
+int print_String_UART(const char* data){
+    return write_UART(data, strlen(data));                  // Copy what fits, rest is counted
 }
 
 void EUSCIA0_IRQHandler(void){
+    TRACE_ENTER(TRACE_EUSCIA0);
     //////////////////////////////////////////////////////////
     //                  Receive Handler                     //
     //////////////////////////////////////////////////////////
-//    if(EUSCI_A0->IFG & EUSCI_A_IFG_RXIFG){                  // If flag is for RX
-//
-//    }
+    if(EUSCI_A0->IFG & EUSCI_A_IFG_RXIFG){                  // If flag is for RX
+        if(EUSCI_A0->STATW & EUSCI_A_STATW_OE){             // Byte lost before this one was read
+            rxOverrun++;
+        }
+        put_Ring(&RX_BUFFER, EUSCI_A0->RXBUF);              // Store only, reading clears RX flag
+    }
 
+#if !UART_TX_DMA
     //////////////////////////////////////////////////////////
     //                  Transmit Handler                    //
     //////////////////////////////////////////////////////////
     if(EUSCI_A0->IFG & EUSCI_A_IFG_TXCPTIFG){
+        char data;
         EUSCI_A0->IFG   &= ~EUSCI_A_IFG_TXCPTIFG;           // Clear flag
-        TX_WRITE_INDEX = (1+ TX_WRITE_INDEX)                // Increment index with rollover 
-                       % UART_BUFFER_LENGTH;
-        if(TX_WRITE_INDEX != TX_LOAD_INDEX){                // If indexes are not the same
-            EUSCI_A0->TXBUF= TX_BUFFER[TX_WRITE_INDEX];     // Load data to UART TX buffer
+        if(get_Ring(&TX_BUFFER, &data)){                    // If more data waiting
+            EUSCI_A0->TXBUF = data;                         // Load data to UART TX buffer
         }else{                                              // Else no more data
             EUSCI_A0->IE &= ~EUSCI_A_IE_TXCPTIE;            // Stop interrupt
+            txRunning = 0;                                  // Hand ring back to producer
         }
     }
+#endif
+    TRACE_EXIT(TRACE_EUSCIA0);
 }
 
 int  transmission_Complete_UART(void){
-    return  TX_WRITE_INDEX == TX_LOAD_INDEX;                // Return whether tx indices are equal
+    return  !txRunning;                                     // ISR idles only once ring is empty
+}
+
+int write_UART(const char* data, unsigned int length){
+    unsigned int state = __get_PRIMASK();
+    int added;
+    __disable_irq();
+    added = write_Ring(&TX_BUFFER, data, length);           // Binary safe, zeros allowed
+    start_TX_UART();                                        // Kick ISR if it was idle
+    __set_PRIMASK(state);
+    return added;
+}
+
+/* write_Whole_UART()
+ *  Queues a block only if all of it fits, for records that are useless cut
+ *
+ * Returns:
+ *  1 - Block queued
+ *  0 - Not enough room, nothing queued
+ */
+int write_Whole_UART(const char* data, unsigned int length){
+    unsigned int state = __get_PRIMASK();
+    int added = 0;
+    __disable_irq();
+    if(free_Ring(&TX_BUFFER) >= length){                    // Check and copy without interruption
+        write_Ring(&TX_BUFFER, data, length);
+        start_TX_UART();
+        added = 1;
+    }
+    __set_PRIMASK(state);
+    return added;
+}
+
+unsigned int free_UART(void){
+    return free_Ring(&TX_BUFFER);                           // Bytes that can be queued without loss
+}
+
+unsigned int overflow_UART(void){
+    return overflow_Ring(&TX_BUFFER);                       // Bytes dropped because ring was full
+}
+
+//////////////////////////////////////////////////////////////////////
+//                   Receive, thread context only                   //
+//////////////////////////////////////////////////////////////////////
+int  available_UART(void){
+    return used_Ring(&RX_BUFFER);                           // Bytes waiting in RX ring
+}
+
+char read_Char_UART(void){
+    char tempValue = 0;
+    get_Ring(&RX_BUFFER, &tempValue);                       // Left 0 if nothing waiting
+    return tempValue;
+}
+
+void flush_RX_UART(void){
+    flush_Ring(&RX_BUFFER);                                 // Drop everything waiting
+}
+
+void echo_UART(int on){
+    rxEcho = on;                                            // Scripts usually want it off
+}
+
+unsigned int rx_Dropped_UART(void){
+    return overflow_Ring(&RX_BUFFER);                       // Bytes lost because RX ring was full
+}
+
+unsigned int rx_Overrun_UART(void){
+    return rxOverrun;                                       // Bytes lost before ISR read RXBUF
+}
+
+/* init_Line_UART()
+ *  Attaches storage to a line reader and empties it
+ *
+ * Parameters:
+ *  line   - Reader state, owned by the caller
+ *  text   - Storage for the line, kept as long as the reader is used
+ *  length - Size of text, at least 1 for the terminator
+ *
+ * Returns:
+ *  0  - Reader ready
+ *  -1 - No storage, read_Line_UART will never return a line
+ */
+int init_Line_UART(LineBuffer * line, char * text, unsigned int length){
+    line->text   = text;
+    line->length = text ? length : 0;
+    line->index  = 0;
+    return line->length ? 0 : -1;
+}
+
+/* read_Line_UART()
+ *  Builds a line from waiting RX bytes and echoes them, never blocks.
+ *  Line is kept in the reader between calls until carriage return or
+ *  newline arrives. Empty lines are skipped so CR LF endings give one line.
+ *  Characters past length-1 are dropped, line is always null terminated.
+ *
+ * Parameters:
+ *  line - Reader set up by init_Line_UART
+ *
+ * Returns:
+ *  1 - Full line is in line->text
+ *  0 - Line not finished yet, or reader has no storage
+ */
+int read_Line_UART(LineBuffer * line){
+    char input;
+    if(0 == line->length){                                  // No room for a terminator
+        return 0;
+    }
+    while(get_Ring(&RX_BUFFER, &input)){                    // Use everything waiting
+        if(input == 13 || input == '\n'){                   // End of line
+            if(0 == line->index){                           // Second half of CR LF
+                continue;
+            }
+            if(rxEcho){
+                print_String_UART("\r\n");                  // Make it show up cleanly on terminal
+            }
+            line->text[line->index] = 0;
+            line->index = 0;
+            return 1;
+        }
+        if(rxEcho){
+            print_Char_UART(input);                         // Echo input
+        }
+        if(line->index < line->length - 1){                 // Keep room for terminator
+            line->text[line->index++] = input;
+        }
+    }
+    return 0;
+}
+
+/* get_Token_UART()
+ *  Splits a line into space separated tokens in place
+ *
+ * Parameters:
+ *  cursor - Position in line, updated past the returned token
+ *
+ * Returns:
+ *  Pointer to null terminated token, 0 if no tokens remain
+ */
+char * get_Token_UART(char ** cursor){
+    char * token = *cursor;
+    while(*token == ' ' || *token == '\t'){                 // Skip leading spaces
+        token++;
+    }
+    if(0 == *token){                                        // End of line
+        *cursor = token;
+        return 0;
+    }
+    *cursor = token;
+    while(**cursor != 0 && **cursor != ' ' && **cursor != '\t'){
+        (*cursor)++;                                        // Find end of token
+    }
+    if(**cursor != 0){                                      // Terminate and step past it
+        **cursor = 0;
+        (*cursor)++;
+    }
+    return token;
 }
@@ -2,13 +2,33 @@
  * UART.h
  *
  *   This libary holds functions for UART, specifically for assignment 8
- *    init_UART         - Starts UART at a give baud
+ *    init_UART         - Starts UART at a give baud, UART_MIN_BAUD to UART_MAX_BAUD
+ *    calculate_Baud_UART - Finds divider and modulation registers for a baud
+ *    get_Baud_UART     - Returns baud actually generated
+ *    get_Baud_Error_UART - Returns worst case bit timing error in 0.01% units
  *    print_Char_UART   - Prints a single char to the terminal
  *    print_String_UART - Prints a string to the terminal
+ *    write_UART        - Queues a block of binary data
+ *    write_Whole_UART  - Queues a block only if all of it fits
  *    transmission_Complete_UART - Returns if buffer is empty
+ *    overflow_UART     - Returns number of bytes dropped because buffer was full
+ *    free_UART         - Returns number of bytes that can be queued without loss
+ *    available_UART    - Returns number of received bytes waiting
+ *    read_Char_UART    - Returns next received byte
+ *    flush_RX_UART     - Drops all received bytes
+ *    init_Line_UART    - Attaches caller storage to a line reader
+ *    read_Line_UART    - Builds a line from received bytes, non-blocking
+ *    get_Token_UART    - Splits a line into space separated tokens
+ *    echo_UART         - Turns echo of received line characters on or off
+ *    rx_Dropped_UART   - Returns number of bytes dropped because RX buffer was full
+ *    rx_Overrun_UART   - Returns number of bytes lost before the ISR read them
+ *
+ *   RX ISR only stores bytes, all parsing happens in the calling thread
  *
  * Depenedencies:
  *   MSP.h -  Needed for direct register access
+ *   Ring_Buffer.h - Holds TX data between print calls and the ISR
+ *   DMA.h - Moves TX data to the UART when UART_TX_DMA is set
  *
  * Errors:
  *   None Currently May 12, 2017
@@ -17,6 +37,13 @@
  *   May 5,  2017 - Initial Creation
  *   May 10, 2017 - Modified to work with assignment 8
  *   May 12, 2017 - Cleaned and commented
+ *   Oct 19, 2026 - TX moved onto power-of-two ring buffer with overflow count
+ *   Oct 19, 2026 - DMA transmit mode, one interrupt per ring segment
+ *   Oct 19, 2026 - Float divider and BRS if-chain replaced by integer search
+ *   Oct 19, 2026 - High speed limits checked, init_UART reports bad baud
+ *   Oct 19, 2026 - write_UART added for binary frames
+ *   Oct 19, 2026 - Producers made interrupt safe, write_Whole_UART added
+ *   Oct 19, 2026 - RX ring and line reader ported from assignment 7
  *
  *  Author: Drew Hartley, Jordan Jones
  *
@@ -26,12 +53,65 @@
 #define UART_UART_H_
 #include "MSP.h"
 #include <string.h>
-#define UART_BUFFER_LENGTH 20
+#include "Ring_Buffer.h"
+
+//Set to 1 to send TX ring segments by DMA instead of a TX interrupt per byte
+#define UART_TX_DMA 1
+
+#if UART_TX_DMA
+#include "DMA.h"
+#define UART_BUFFER_LENGTH 2048         // Must be a power of two
+#define UART_DMA_CHANNEL   0            // Channel 0 source 1 is eUSCI_A0 TX
+#define UART_DMA_SOURCE    1
+#else
+#define UART_BUFFER_LENGTH 32           // Must be a power of two
+#endif
+#define UART_RX_LENGTH     256          // Must be a power of two
 #define F_CPU 48000000
+#define UART_MAX_BAUD   (F_CPU/16)      // 3 Mbaud at 48 MHz, lowest oversampled divider
+#define UART_MIN_BAUD   ((F_CPU + 16*65536 - 1)/(16*65536)) // 46 baud at 48 MHz, BRW is 16 bits
+#define UART_MAX_ERROR  100             // Worst bit error allowed, 0.01% units
+
+//Divider terms, constant expressions when clock and baud are constants
+#define UART_FRAME_BITS         10      // Start, 8 data, stop
+#define UART_OS16(clock, baud)  ((clock)/(baud) >= 16)
+#define UART_BRW(clock, baud)   (UART_OS16(clock, baud) ? (clock)/(16*(baud)) : (clock)/(baud))
+#define UART_BRF(clock, baud)   (UART_OS16(clock, baud) ? ((clock)%(16*(baud)))/(baud) : 0)
+
+//Data struct for a baud calculation
+typedef struct{
+    unsigned int  brw;                  // Value for BRW
+    unsigned int  mctlw;                // Value for MCTLW (OS16, BRF, BRS)
+    unsigned long baud;                 // Baud actually generated
+    int           error;                // Worst case bit error, 0.01% units
+}BaudConfig;
+
+//Line being built by read_Line_UART, one per caller so lines never mix
+typedef struct{
+    char *       text;                  // Caller storage, kept for the whole line
+    unsigned int length;                // Size of text including terminator
+    unsigned int index;                 // Characters stored so far
+}LineBuffer;
 
-void init_UART(unsigned int baud);
-void print_Char_UART(char data);
-void print_String_UART(const char* data);
+int  init_UART(unsigned int baud);
+void calculate_Baud_UART(unsigned long clock, unsigned long baud, BaudConfig * config);
+unsigned long get_Baud_UART(void);
+int  get_Baud_Error_UART(void);
+int  print_Char_UART(char data);
+int  print_String_UART(const char* data);
+int  write_UART(const char* data, unsigned int length);
+int  write_Whole_UART(const char* data, unsigned int length);
 int  transmission_Complete_UART(void);
+unsigned int overflow_UART(void);
+unsigned int free_UART(void);
+int  available_UART(void);
+char read_Char_UART(void);
+void flush_RX_UART(void);
+int  init_Line_UART(LineBuffer * line, char * text, unsigned int length);
+int  read_Line_UART(LineBuffer * line);
+char * get_Token_UART(char ** cursor);
+void echo_UART(int on);
+unsigned int rx_Dropped_UART(void);
+unsigned int rx_Overrun_UART(void);
 
 #endif /* UART_UART_H_ */
@@ -2,48 +2,1090 @@
  * Main.c
  *    Main function for assignment 8 ADC
  *
+ *    MODE_ADC_ASCII  - Streams oversampled ADC reading as x.xx text
+ *    MODE_THROUGHPUT - Streams a numbered test pattern and reports
+ *                      bytes per second and skipped lines once a second
+ *    MODE_ADC_BINARY - Samples at SAMPLE_RATE and streams raw 14 bit
+ *                      samples in COBS/CRC frames, see Stream.h
+ *    MODE_ADC_LOG    - Logs each reading with sequence, timestamp and latency
+ *                      as a deferred binary record, format on host with
+ *                      Host_Tools/log_decode.py
+ *    MODE_SHELL      - Takes commands over UART to drive the waveform
+ *                      generator, ADC capture and ADC to DAC filter
+ *                      pipeline, send HELP for a list
+ *    MODE_STATS      - Shows min, max, mean, RMS, peak to peak and frequency
+ *                      on the LCD and as '#' lines over UART
+ *    MODE_SPECTRUM   - FFT_SIZE point Q15 FFT of each capture sent as a
+ *                      spectrum frame with the FFT cycle count, see Stream.h
+ *    MODE_SCOPE      - Edge triggered captures with pre-trigger history sent
+ *                      as capture frames, trigger set by the SCOPE_ defines
+ *    MODE_MONITOR    - ADC window comparator watches MONITOR_ limits, CPU
+ *                      sleeps and sends a '#' line per crossing
+ *    MODE_ANALYZER   - Sweeps the generator over BODE_FREQS and sends gain
+ *                      and phase of the ADC response per frequency
+ *
+ *    Throughput pattern is one line per sequence number, check it on host
+ *    with Host_Tools/throughput_check.py. Report lines start with '#'.
+ *
  * Errors:
  *   None Currently May 5, 2017
  *
  * Revisions:
  *   May 5,  2017 - Initial Creation
  *   May 12, 2017 - Cleaned and commented
+ *   Oct 19, 2026 - Throughput test mode for high speed UART
+ *   Oct 19, 2026 - Binary framed ADC streaming mode
+ *   Oct 19, 2026 - Deferred binary logging mode
+ *   Oct 19, 2026 - Command shell mode for scripted bench control
+ *   Oct 19, 2026 - Binary and shell capture use timer triggered ADC blocks
+ *   Oct 19, 2026 - Shell capture of several inputs with CHAN
+ *   Oct 19, 2026 - ASCII mode oversampled through Decimator
+ *   Oct 19, 2026 - Integer calibrated millivolts, shell CAL command
+ *   Oct 19, 2026 - Statistics mode and shell summary capture
+ *   Oct 19, 2026 - Fixed point FFT spectrum mode
+ *   Oct 19, 2026 - Shell FILT, COEF and PIPE for the ADC to DAC filter pipeline
+ *   Oct 19, 2026 - Triggered scope mode
+ *   Oct 19, 2026 - Window comparator monitor mode
+ *   Oct 19, 2026 - Log mode uses sequenced ADC samples, STAT adds adc_lost
+ *   Oct 19, 2026 - Network analyzer mode
+ *   Oct 19, 2026 - Shell TONE and CAPT TONE for Goertzel tone levels
+ *   Oct 19, 2026 - Shell CAL DAC linearity sweep
+ *   Oct 19, 2026 - Shell PROF dump of profile probes
+ *   Oct 19, 2026 - Trace pins set up for logic analyzer builds
  *
  *  Author: Drew Hartley, Jordan Jones
  */
 
 #include "msp.h"
+#include "stdio.h"
 #include "Clocks.h"
 #include "ADC.h"
 #include "UART.h"
+#include "Stream.h"
+#include "Log.h"
+#include "Shell.h"
+#include "Function_Generator.h"
+#include "Pipeline.h"
+#include "Decimator.h"
+#include "Statistics.h"
+#include "FFT.h"
+#include "Cycles.h"
+#include "Scope.h"
+#include "Analyzer.h"
+#include "Goertzel.h"
+#include "Linearity.h"
+#include "Profile.h"
+#include "Trace.h"
+#define FCPU FREQ_48_MHZ
+#include "Liquid_Crystal.h"
 
+///////////////////////////////////////////////////////////////////////
+//                        Mode Defines (DO NOT EDIT)                 //
+///////////////////////////////////////////////////////////////////////
+#define MODE_ADC_ASCII      0
+#define MODE_THROUGHPUT     1
+#define MODE_ADC_BINARY     2
+#define MODE_ADC_LOG        3
+#define MODE_SHELL          4
+#define MODE_STATS          5
+#define MODE_SPECTRUM       6
+#define MODE_SCOPE          7
+#define MODE_MONITOR        8
+#define MODE_ANALYZER       9
 
 #define ONES 1
 #define TENTHS 3
 #define HUNDREDTHS 4
 
+#define PATTERN_LENGTH      64          // Bytes per pattern line including CR LF
+
+//Capture states for shell mode
+#define CAPTURE_OFF         0
+#define CAPTURE_START       1           // Delimiter still to send
+#define CAPTURE_ON          2
+
+#define SUMMARY_LENGTH      96          // Longest summary line
+#define TONE_LINE_LENGTH    (8 + GOERTZEL_MAX_TONES*20)
+#define REPLY_LENGTH        192         // Longest shell reply, summary or tone line
+
+//Capture outputs for shell mode
+#define OUTPUT_FRAMES       0           // Binary sample frames
+#define OUTPUT_SUMMARY      1           // Statistics '#' lines
+#define OUTPUT_TONES        2           // Goertzel level '#' lines, one per block
+
+///////////////////////////////////////////////////////////////////////
+//                        Running mode (EDITABLE)                    //
+///////////////////////////////////////////////////////////////////////
+#define MODE                MODE_ADC_ASCII
+#define BAUD                750000      // Up to UART_MAX_BAUD (3000000)
+#define SAMPLE_RATE         10000       // Binary and ASCII mode samples per second
+#define OVERSAMPLE_K        4           // ASCII mode averages 4^k samples, k extra bits
+#define SUMMARIES           2           // Statistics windows per second
+#define CAL_SAMPLE_SHIFT    8           // Calibration points average 2^8 conversions
+#define CAL_SAMPLES         (1 << CAL_SAMPLE_SHIFT)
+#define TIMESTAMPS          1           // Add MCLK timestamp to binary frames
+#define SCOPE_EDGE          rising
+#define SCOPE_LEVEL_MV      1650        // Trigger level
+#define SCOPE_HYSTERESIS_MV 50          // Signal must go this far past level to rearm
+#define SCOPE_PRE           128         // Samples before trigger
+#define SCOPE_POST          384         // Samples from trigger on, pre + post <= SCOPE_LENGTH
+#define MONITOR_LOW_MV      500         // Monitor mode limits
+#define MONITOR_HIGH_MV     2800
+#define BODE_AMPLITUDE_MV   1000        // Stimulus peak to peak
+#define BODE_OFFSET_MV      1650        // Stimulus center
+
+#if ADC_BLOCK_SIZE > STREAM_MAX_SAMPLES
+#error "ADC blocks must fit in one stream frame"
+#endif
+#if FFT_SIZE % ADC_BLOCK_SIZE || FFT_BINS > STREAM_MAX_BINS
+#error "FFT must be whole ADC blocks and fit in one spectrum frame"
+#endif
+#if SCOPE_LENGTH > STREAM_MAX_CAPTURE
+#error "Scope captures must fit in one capture frame"
+#endif
+#if SUMMARY_LENGTH > REPLY_LENGTH || TONE_LINE_LENGTH > REPLY_LENGTH
+#error "Summary and tone lines must fit in the shell reply buffer"
+#endif
+
+void run_ADC_ASCII(void);
+void run_Throughput(void);
+void run_ADC_Binary(void);
+void run_ADC_Log(void);
+void run_Shell(void);
+void run_Stats(void);
+void run_Spectrum(void);
+void run_Scope(void);
+void run_Monitor(void);
+void run_Analyzer(void);
+void format_Summary(char * text, const StatResult * result);
+void format_Tones(char * text, const Goertzel * bank, const unsigned int * levels);
+int  command_IDN(char * args, int query);
+int  command_Wave(char * args, int query);
+int  command_Freq(char * args, int query);
+int  command_Duty(char * args, int query);
+int  command_Ampl(char * args, int query);
+int  command_Offs(char * args, int query);
+int  command_Outp(char * args, int query);
+int  command_Capt(char * args, int query);
+int  command_Meas(char * args, int query);
+int  command_Rate(char * args, int query);
+int  command_Chan(char * args, int query);
+int  command_Cal(char * args, int query);
+int  command_Stat(char * args, int query);
+int  command_Echo(char * args, int query);
+int  command_Filt(char * args, int query);
+int  command_Coef(char * args, int query);
+int  command_Pipe(char * args, int query);
+int  command_Tone(char * args, int query);
+int  command_Prof(char * args, int query);
+
+///////////////////////////////////////////////////////////////////////
+//                              Global Data                          //
+///////////////////////////////////////////////////////////////////////
+const Command commandTable[] = {
+    {"*IDN", command_IDN,  "? Board name"},
+    {"WAVE", command_Wave, "SQR|SAW|SIN|TRI, or ? for current"},
+    {"FREQ", command_Freq, "Hz, or ? for current"},
+    {"DUTY", command_Duty, "Square high percent 1-99, or ?"},
+    {"AMPL", command_Ampl, "Peak to peak mV, or ?"},
+    {"OFFS", command_Offs, "Center mV, or ?"},
+    {"OUTP", command_Outp, "ON|OFF generator output, or ?"},
+    {"CAPT", command_Capt, "ON|OFF binary ADC frames (Stream.h), SUMM or TONE for '#' lines, or ?"},
+    {"RATE", command_Rate, "Capture samples per second per input, or ?"},
+    {"CHAN", command_Chan, "Inputs to capture e.g. 1 2 3, frames hold each in turn, or ?"},
+    {"MEAS", command_Meas, "? One ADC reading in mV"},
+    {"CAL",  command_Cal,  "LOW mV|HIGH mV with that voltage applied, SOLVE, DAC with DAC wired to ADC, SAVE, or ?"},
+    {"STAT", command_Stat, "? Baud, error and drop counters"},
+    {"ECHO", command_Echo, "ON|OFF terminal echo"},
+    {"FILT", command_Filt, "FIR taps|IIR sections|NONE applies loaded COEFs, or ?"},
+    {"COEF", command_Coef, "index values..., Q15 taps or Q14 b0 b1 b2 a1 a2 per section"},
+    {"PIPE", command_Pipe, "ON [rate]|OFF|CLR ADC to filter to DAC, or ? for cost and latency"},
+    {"TONE", command_Tone, "Hz... up to 8 tones for CAPT TONE, 2 bins short of RATE/2, or ?"},
+    {"PROF", command_Prof, "? Cycles per profile probe (Profile.h), or CLR"}
+};
+
+volatile int captureState = CAPTURE_OFF;
+unsigned int captureRate  = SAMPLE_RATE;
+unsigned char captureInputs[ADC_MAX_CHANNELS] = {ADC_DEFAULT_INPUT};
+unsigned int captureChannels = 1;
+unsigned int pipeRate = SAMPLE_RATE;
+
+//Analyzer mode frequencies in Hz, 1 to GEN_MAX_FREQ
+const unsigned short BODE_FREQS[] = {10, 20, 50, 100, 200, 300, 500, 700, 1000, 1500, 2000};
+int captureOutput = OUTPUT_FRAMES;      // Summary and tone lines use first input only
+unsigned int toneFreqs[GOERTZEL_MAX_TONES] = {50, 60, 1000};
+unsigned int toneCount = 3;
+Goertzel toneBank;                      // Set from toneFreqs by CAPT TONE
+static char reply[REPLY_LENGTH];        // Shell replies and capture lines, kept off the stack
+
 void main(void)
 {
-    char message[] = {0x0D,'0','.','0','0'};    // Message format
-                                                // x.xx with carriage return to overwrite
     WDTCTL = WDTPW | WDTHOLD;                   // Stop watchdog timer
     set_DCO(FREQ_48_MHZ);                       // Set to 48 MHz
+    init_Trace();                               // Nothing unless TRACE_MODE is set
     __enable_irq();                             // Enable interrupts
-    init_UART(750000);                          // Start UART
+    if(init_UART(BAUD)){                        // Start UART
+        while(1);                               // Baud not possible, stop here
+    }
     init_ADC();                                 // Start ADC
+    init_Calibration();                         // Saved gain and offset if board was calibrated
+    init_Profile();                             // Nothing when probes are compiled out
 
+    TIMER32_1->LOAD    = 0xFFFFFFFF;            // Free running down counter at MCLK for timing
+    TIMER32_1->CONTROL = TIMER32_CONTROL_SIZE | TIMER32_CONTROL_ENABLE;
+
+#if MODE == MODE_THROUGHPUT
+    run_Throughput();
+#elif MODE == MODE_ADC_BINARY
+    run_ADC_Binary();
+#elif MODE == MODE_ADC_LOG
+    run_ADC_Log();
+#elif MODE == MODE_SHELL
+    run_Shell();
+#elif MODE == MODE_STATS
+    run_Stats();
+#elif MODE == MODE_SPECTRUM
+    run_Spectrum();
+#elif MODE == MODE_SCOPE
+    run_Scope();
+#elif MODE == MODE_MONITOR
+    run_Monitor();
+#elif MODE == MODE_ANALYZER
+    run_Analyzer();
+#else
+    run_ADC_ASCII();
+#endif
+}
+
+/* run_ADC_ASCII()
+ *  Sends latest reading as x.xx with carriage return to overwrite.
+ *  Samples run continuously at SAMPLE_RATE and are averaged 4^OVERSAMPLE_K
+ *  to one reading, a new message goes out whenever the last one is sent.
+ */
+void run_ADC_ASCII(void){
+    char message[] = {0x0D,'0','.','0','0',0}; // Message format
+                                                // x.xx with carriage return to overwrite
+    static unsigned int outputs[ADC_BLOCK_SIZE + 1];   // Too big for the 512 byte stack
+    Decimator stage;
+    ADCBlock block;
+
+    init_Decimator(&stage, OVERSAMPLE_K);
+    start_Continuous_ADC(SAMPLE_RATE);
     while(1){
-        if(transmission_Complete_UART()){       // Message sent
-            print_String_UART(message);         // Load next message
-            run_ADC();                          // Start next poll while sending data
-            while(!hasNew_ADC());               // Wait for new ADC data (comes faster than UART send)
-            float value = get_ADC();
+        if(get_Block_ADC(&block)){
+            unsigned int count = run_Decimator(&stage, block.samples, block.count, outputs);
+            release_Block_ADC();
+            if(count && transmission_Complete_UART()){  // Message sent, load newest reading
+                int mV = mV_ADC(outputs[count - 1], bits_Decimator(&stage));
+                if(mV < 0){                     // Offset can put zero input just below
+                    mV = 0;
+                }
                                                 //Convert number to string
-            message[ONES]       = (int)value + '0';
-            message[TENTHS]     = (int)(value * 10)%10 + '0';
-            message[HUNDREDTHS] = (int)(value * 100)%10 + '0';
+                message[ONES]       = (mV/1000)%10 + '0';
+                message[TENTHS]     = (mV/100)%10 + '0';
+                message[HUNDREDTHS] = (mV/10)%10 + '0';
+                print_String_UART(message);
+            }
         }
     }
 }
 
+/* run_Throughput()
+ *  Offers pattern lines "SSSSSSSS:ABC...\r\n" where S is a hex sequence
+ *  number, one per line time at the generated baud (Timer32 counts MCLK).
+ *  A line that does not fit in the TX buffer when due is skipped but still
+ *  uses its sequence number, so the host sees one gap per skipped line.
+ *  Once a second a report line with accepted bytes, ideal bytes (baud/10)
+ *  and skipped lines goes out in place of one pattern line.
+ */
+void run_Throughput(void){
+    const char hex[] = "0123456789ABCDEF";
+    static char line[PATTERN_LENGTH + 1];       // Static so sprintf and the ISRs have the stack
+    static char report[PATTERN_LENGTH + 1];
+    unsigned int sequence = 0;
+    unsigned int bytes = 0;
+    unsigned int skipped = 0;
+    unsigned int period;                        // MCLK cycles per line at the generated baud
+    unsigned int start, due;
+    int reportDue = 0;
+    int i;
+
+    for(i = 9; i < PATTERN_LENGTH - 2; i++){    // Fixed payload after "SSSSSSSS:"
+        line[i] = 'A' + (i % 26);
+    }
+    line[8] = ':';
+    line[PATTERN_LENGTH - 2] = '\r';
+    line[PATTERN_LENGTH - 1] = '\n';
+    line[PATTERN_LENGTH]     = 0;
+    period = (unsigned int)(((unsigned long long)F_CPU*UART_FRAME_BITS*PATTERN_LENGTH)/get_Baud_UART());
+
+    start = TIMER32_1->VALUE;
+    due   = start;
+
+    while(1){
+        if((due - TIMER32_1->VALUE) >= period){ // Next line is due, counter counts down
+            due -= period;
+            if(reportDue){                      // Report takes this line's place
+                reportDue = !write_Whole_UART(report, strlen(report));
+            }else{
+                unsigned int value = sequence++;
+                for(i = 7; i >= 0; i--){        // Sequence number as 8 hex digits
+                    line[i] = hex[value & 0xF];
+                    value >>= 4;
+                }
+                if(write_Whole_UART(line, PATTERN_LENGTH)){
+                    bytes += PATTERN_LENGTH;
+                }else{
+                    skipped++;                  // No room, host sees a gap
+                }
+            }
+        }
+        if((start - TIMER32_1->VALUE) >= F_CPU){// One second passed
+            start -= F_CPU;
+            sprintf(report, "# %u B/s of %lu, skipped %u lines\r\n",
+                    bytes, get_Baud_UART()/UART_FRAME_BITS, skipped);
+            bytes = 0;
+            skipped = 0;
+            reportDue = 1;                      // Replaces any report not sent yet
+        }
+    }
+}
+
+/* run_ADC_Binary()
+ *  Samples continuously at SAMPLE_RATE and sends each ADC block as one
+ *  binary frame. Timestamp is counted from the block sequence since the
+ *  sample timer runs from the same clock as MCLK, so it shows no jitter.
+ */
+void run_ADC_Binary(void){
+    ADCBlock block;
+
+    start_Continuous_ADC(SAMPLE_RATE);
+    while(1){
+        if(get_Block_ADC(&block)){              // Block full, frame it
+            send_Samples_Stream(block.samples, block.count, TIMESTAMPS,
+                                block.sequence*ADC_BLOCK_SIZE*(F_CPU/SAMPLE_RATE));
+            release_Block_ADC();
+        }
+    }
+}
+
+/* run_ADC_Log()
+ *  Logs each reading with its sequence number, capture time and delay
+ *  from capture to here in cycles, no formatting is done on target so a
+ *  record costs a few stores instead of a sprintf. A jump in seq is a lost
+ *  reading.
+ */
+void run_ADC_Log(void){
+    ADCSample sample;
+    while(1){
+        run_ADC();                              // Start next conversion
+        while(!get_Sample_ADC(&sample));        // Wait for result
+        LOG4("ADC seq=%u raw=%u t=%u lat=%u", sample.sequence, sample.value,
+             sample.timestamp, get_Cycles() - sample.timestamp);
+    }
+}
+
+/* run_Shell()
+ *  Runs commands between blocks. While capture is on samples are sent in
+ *  binary frames as in run_ADC_Binary, replies still come as
+ *  text so host should stop decoding frames once it sends CAPT OFF.
+ *  CAPT SUMM and CAPT TONE send '#' text lines instead of frames.
+ */
+void run_Shell(void){
+    static ADCBlock block;                      // Static so handlers have the stack
+    static Statistics stats;
+    static StatResult result;
+    static unsigned int levels[GOERTZEL_MAX_TONES];
+
+    init_Generator();
+    init_Shell(commandTable, sizeof(commandTable)/sizeof(commandTable[0]));
+    reply_Shell("Ready, send HELP for commands");
+
+    while(1){
+        poll_Shell();                           // Run a command if a line came in
+        if(CAPTURE_START == captureState){
+            if(OUTPUT_FRAMES == captureOutput){ // Delimiter ends any reply text for the decoder
+                print_Char_UART(0);
+            }
+            init_Statistics(&stats);
+            start_Sequence_ADC(captureInputs, captureChannels, captureRate);
+            captureState = CAPTURE_ON;
+        }else if(CAPTURE_ON == captureState && get_Block_ADC(&block)){
+            if(OUTPUT_SUMMARY == captureOutput){        // First input only, a few lines a second
+                update_Statistics(&stats, block.samples, block.count);
+                if(stats.count >= captureRate/SUMMARIES){
+                    result_Statistics(&stats, captureRate, &result);
+                    format_Summary(reply, &result);
+                    reply_Shell(reply);
+                }
+            }else if(OUTPUT_TONES == captureOutput){    // First input only, every block
+                run_Goertzel(&toneBank, block.samples, block.count);
+                result_Goertzel(&toneBank, levels);
+                format_Tones(reply, &toneBank, levels);
+                reply_Shell(reply);
+            }else{
+                send_Samples_Stream(block.samples, block.count*block.channels, TIMESTAMPS,
+                                    block.sequence*block.count*(F_CPU/captureRate));  // Scans, not samples
+            }
+            release_Block_ADC();
+        }
+    }
+}
+
+/* run_Stats()
+ *  Samples continuously and shows statistics of each window on the LCD
+ *  and as a '#' line over UART, SUMMARIES times a second
+ */
+void run_Stats(void){
+    static ADCBlock block;                      // Static so sprintf and the ISRs have the stack
+    static Statistics stats;
+    static StatResult result;
+    static char summary[SUMMARY_LENGTH];
+    static char line[17];                       // One LCD row
+
+    init_LCD();
+    init_Statistics(&stats);
+    start_Continuous_ADC(SAMPLE_RATE);
+    while(1){
+        if(get_Block_ADC(&block)){
+            update_Statistics(&stats, block.samples, block.count);
+            release_Block_ADC();
+            if(stats.count >= SAMPLE_RATE/SUMMARIES){
+                result_Statistics(&stats, SAMPLE_RATE, &result);
+                format_Summary(summary, &result);
+                print_String_UART(summary);
+                print_String_UART("\r\n");
+
+                //LCD takes a few ms, ADC blocks queue meanwhile
+                set_Cursor_LCD(0,0);
+                sprintf(line, "%4u.%02uHz P%4d ", result.centiHz/100, result.centiHz%100,
+                        mV_ADC(result.max, 14) - mV_ADC(result.min, 14));
+                print_String_LCD(line);
+                set_Cursor_LCD(0,1);
+                sprintf(line, "M%4d R%4d     ", mV_ADC(result.mean, 14),
+                        (int)(((long long)result.acRms*get_Calibration()->gain + 0x8000) >> 16));
+                print_String_LCD(line);
+            }
+        }
+    }
+}
+
+/* run_Spectrum()
+ *  Gathers FFT_SIZE samples from consecutive ADC blocks, windows them and
+ *  sends the magnitude spectrum. A dropped block restarts the capture so
+ *  each spectrum comes from evenly spaced samples. Blocks queue while the
+ *  FFT runs, the cycle count of window, FFT and magnitude is in each frame.
+ */
+void run_Spectrum(void){
+    static unsigned short samples[FFT_SIZE];
+    static short re[FFT_SIZE];
+    static short im[FFT_SIZE];
+    static unsigned short bins[FFT_BINS];
+    ADCBlock block;
+    unsigned int filled = 0;
+    unsigned int next = 0;                      // Sequence of next expected block
+
+    init_Cycles();
+    start_Continuous_ADC(SAMPLE_RATE);
+    while(1){
+        if(get_Block_ADC(&block)){
+            if(block.sequence != next){         // Gap, samples would not be evenly spaced
+                filled = 0;
+            }
+            next = block.sequence + 1;
+            memcpy(&samples[filled], block.samples, ADC_BLOCK_SIZE*sizeof(samples[0]));
+            filled += ADC_BLOCK_SIZE;
+            release_Block_ADC();
+
+            if(filled == FFT_SIZE){
+                unsigned int start = get_Cycles();
+                window_FFT(samples, re, im);
+                run_FFT(re, im);
+                magnitude_FFT(re, im, bins);
+                send_Spectrum_Stream(bins, FFT_BINS, FFT_SIZE, SAMPLE_RATE, get_Cycles() - start);
+                filled = 0;
+            }
+        }
+    }
+}
+
+/* run_Scope()
+ *  Samples continuously and sends each triggered capture as one frame,
+ *  then rearms at once. A dropped block restarts the history so no
+ *  capture spans a hole.
+ */
+void run_Scope(void){
+    static Scope scope;
+    ScopeConfig config;
+    ADCBlock block;
+    unsigned int next = 0;                      // Sequence of next expected block
+    unsigned int base = 0;                      // Sample number where history restarted
+
+    config.edge       = SCOPE_EDGE;
+    config.level      = raw_ADC(SCOPE_LEVEL_MV);
+    config.hysteresis = raw_ADC(SCOPE_LEVEL_MV + SCOPE_HYSTERESIS_MV) - config.level;
+    config.pre        = SCOPE_PRE;
+    config.post       = SCOPE_POST;
+    if(init_Scope(&scope, &config)){
+        while(1);                               // Bad SCOPE_ settings, stop here
+    }
+    start_Continuous_ADC(SAMPLE_RATE);
+    while(1){
+        if(get_Block_ADC(&block)){
+            if(block.sequence != next){         // Gap, history has a hole
+                init_Scope(&scope, &config);
+                base = block.sequence*ADC_BLOCK_SIZE;
+            }
+            next = block.sequence + 1;
+            if(update_Scope(&scope, block.samples, block.count)){
+                send_Capture_Stream(scope.capture, SCOPE_PRE + SCOPE_POST, SCOPE_PRE,
+                                    base + scope.trigger,
+                                    (falling == SCOPE_EDGE) ? STREAM_FLAG_FALLING : 0);
+                arm_Scope(&scope);
+            }
+            release_Block_ADC();
+        }
+    }
+}
+
+/* run_Monitor()
+ *  Hardware compares every sample to the limits, the CPU only wakes for
+ *  a crossing (or UART traffic) and reports it
+ */
+void run_Monitor(void){
+    const char * names[] = {"below", "inside", "above"};  // ADCZone enum order
+    char line[48];
+    ADCEvent event;
+    unsigned int missed = 0;
+
+    start_Monitor_ADC(ADC_DEFAULT_INPUT, SAMPLE_RATE,
+                      raw_ADC(MONITOR_LOW_MV), raw_ADC(MONITOR_HIGH_MV));
+    while(1){
+        while(get_Event_ADC(&event)){
+            sprintf(line, "# %s %d mV\r\n", names[event.zone], mV_ADC(event.value, 14));
+            print_String_UART(line);
+        }
+        if(missed != missed_Event_ADC()){
+            missed = missed_Event_ADC();
+            sprintf(line, "# missed %u\r\n", missed);
+            print_String_UART(line);
+        }
+        __disable_irq();                        // Event between check and sleep still wakes WFI
+        if(!available_Event_ADC()){
+            __WFI();
+        }
+        __enable_irq();
+    }
+}
+
+/* run_Analyzer()
+ *  Sweeps BODE_FREQS over and over, one '#' line per frequency and a
+ *  blank line after each sweep
+ */
+void run_Analyzer(void){
+    static char line[80];                       // Static so sprintf and the ISRs have the stack
+    WaveData wave = {sine, BODE_FREQS[0], 50, BODE_AMPLITUDE_MV, BODE_OFFSET_MV};
+    AnalyzerResult result;
+    ADCBlock block;
+    unsigned int point;
+    unsigned int db, degrees;                   // Magnitudes in hundredths
+
+    init_Generator();
+    set_Wave_Generator(&wave);
+    while(1){
+        for(point = 0; point < sizeof(BODE_FREQS)/sizeof(BODE_FREQS[0]); point++){
+            if(start_Analyzer(BODE_FREQS[point])){
+                continue;                       // Not a generator frequency
+            }
+            while(1){
+                if(get_Block_ADC(&block)){
+                    int done = update_Analyzer(&block);
+                    release_Block_ADC();
+                    if(done){
+                        break;
+                    }
+                }
+            }
+            result_Analyzer(&result);
+            db      = (result.centiDB < 0) ? -result.centiDB : result.centiDB;
+            degrees = (result.centiDegrees < 0) ? -result.centiDegrees : result.centiDegrees;
+            sprintf(line, "# f=%u n=%u amp=%d mV gain=%c%u.%02u dB phase=%c%u.%02u deg\r\n",
+                    result.freq, result.samples, result.amplitude,
+                    (result.centiDB < 0) ? '-' : '+', db/100, db%100,
+                    (result.centiDegrees < 0) ? '-' : '+', degrees/100, degrees%100);
+            print_String_UART(line);
+        }
+        stop_Analyzer();
+        print_String_UART("\r\n");
+    }
+}
+
+/* format_Tones()
+ *  Writes one block of tone levels as a '#' line, peak mV to 0.1 mV
+ */
+void format_Tones(char * text, const Goertzel * bank, const unsigned int * levels){
+    int gain = get_Calibration()->gain;
+    unsigned int tone;
+    text += sprintf(text, "# tones");
+    for(tone = 0; tone < bank->count; tone++){
+        unsigned int tenths = (unsigned int)(((unsigned long long)levels[tone]*gain*10 +
+                              (1u << (15 + GOERTZEL_LEVEL_BITS))) >> (16 + GOERTZEL_LEVEL_BITS));
+        text += sprintf(text, " %u=%u.%u", bank->freq[tone], tenths/10, tenths%10);
+    }
+}
+
+/* format_Summary()
+ *  Writes one statistics window as a '#' line, voltages in mV.
+ *  RMS keeps the offset, AC RMS only needs gain.
+ */
+void format_Summary(char * text, const StatResult * result){
+    int gain = get_Calibration()->gain;
+    sprintf(text, "# n=%u min=%d max=%d mean=%d p2p=%d rms=%d ac=%d freq=%u.%02u",
+            result->count, mV_ADC(result->min, 14), mV_ADC(result->max, 14),
+            mV_ADC(result->mean, 14), mV_ADC(result->max, 14) - mV_ADC(result->min, 14),
+            mV_ADC(result->rms, 14), (int)(((long long)result->acRms*gain + 0x8000) >> 16),
+            result->centiHz/100, result->centiHz%100);
+}
+
+///////////////////////////////////////////////////////////////////////
+//                         Shell Command Handlers                    //
+///////////////////////////////////////////////////////////////////////
+
+/* command_XXXX()
+ *  Handlers for commandTable, see Shell.h for parameters and returns
+ */
+
+int command_IDN(char * args, int query){
+    if(!query){
+        return SHELL_QUERY_ONLY;
+    }
+    reply_Shell("MSP432 ADC bench, assignment 8");
+    return SHELL_OK;
+}
+
+int command_Wave(char * args, int query){
+    const char * names[] = {"SQR", "SAW", "SIN", "TRI"};    // Waveform enum order
+    char * token = get_Token_UART(&args);
+    WaveData wave;
+    int i;
+
+    get_Wave_Generator(&wave);
+    if(query){
+        reply_Shell(names[wave.form]);
+        return SHELL_OK;
+    }
+    for(i = 0; i < 4; i++){
+        if(token && match_Shell(token, names[i])){
+            wave.form = (Waveform)i;
+            return set_Wave_Generator(&wave) ? SHELL_BAD_ARGUMENT : SHELL_OK;
+        }
+    }
+    return SHELL_BAD_ARGUMENT;
+}
 
+/* set_Wave_Field()
+ *  Shared body for the numeric waveform commands
+ *
+ * Parameters:
+ *  field - Member of a WaveData copy to query or change
+ */
+static int set_Wave_Field(char * args, int query, WaveData * wave, unsigned int * field){
+    long value;
+    if(query){
+        sprintf(reply, "%u", *field);
+        reply_Shell(reply);
+        return SHELL_OK;
+    }
+    if(number_Shell(get_Token_UART(&args), &value) || value < 0){
+        return SHELL_BAD_ARGUMENT;
+    }
+    *field = (unsigned int)value;
+    return set_Wave_Generator(wave) ? SHELL_BAD_ARGUMENT : SHELL_OK;
+}
+
+int command_Freq(char * args, int query){
+    WaveData wave;
+    get_Wave_Generator(&wave);
+    return set_Wave_Field(args, query, &wave, &wave.freq);
+}
+
+int command_Duty(char * args, int query){
+    WaveData wave;
+    get_Wave_Generator(&wave);
+    return set_Wave_Field(args, query, &wave, &wave.duty);
+}
+
+int command_Ampl(char * args, int query){
+    WaveData wave;
+    get_Wave_Generator(&wave);
+    return set_Wave_Field(args, query, &wave, &wave.amplitude);
+}
+
+int command_Offs(char * args, int query){
+    WaveData wave;
+    get_Wave_Generator(&wave);
+    return set_Wave_Field(args, query, &wave, &wave.offset);
+}
+
+/* parse_On_Off()
+ *  Returns 1 for ON, 0 for OFF, -1 for anything else
+ */
+static int parse_On_Off(char * args){
+    char * token = get_Token_UART(&args);
+    if(token && match_Shell(token, "ON")){
+        return 1;
+    }
+    if(token && match_Shell(token, "OFF")){
+        return 0;
+    }
+    return -1;
+}
+
+int command_Outp(char * args, int query){
+    int on;
+    if(query){
+        reply_Shell(running_Generator() ? "ON" : "OFF");
+        return SHELL_OK;
+    }
+    on = parse_On_Off(args);
+    if(on < 0){
+        return SHELL_BAD_ARGUMENT;
+    }
+    if(on && running_Pipeline()){           // DAC owned by pipeline
+        return SHELL_BUSY;
+    }
+    output_Generator(on);
+    return SHELL_OK;
+}
+
+int command_Capt(char * args, int query){
+    int on;
+    if(query){
+        const char * names[] = {"ON", "SUMM", "TONE"};     // OUTPUT_ order
+        reply_Shell(CAPTURE_OFF == captureState ? "OFF" : names[captureOutput]);
+        return SHELL_OK;
+    }
+    {
+        char * peek = args;                 // Look at argument without using it up
+        char * token = get_Token_UART(&peek);
+        on = (token && match_Shell(token, "SUMM")) ? 2 :
+             (token && match_Shell(token, "TONE")) ? 3 : parse_On_Off(args);
+    }
+    if(on < 0){
+        return SHELL_BAD_ARGUMENT;
+    }
+    if(on && running_Pipeline()){           // ADC owned by pipeline
+        return SHELL_BUSY;
+    }
+    if(on && CAPTURE_OFF == captureState){  // Frames start after the OK
+        if(3 == on && set_Goertzel(&toneBank, toneFreqs, toneCount, captureRate,
+                                   ADC_BLOCK_SIZE/captureChannels)){
+            return SHELL_BAD_ARGUMENT;      // A tone is too close to RATE/2 for one block
+        }
+        captureOutput = on - 1;             // ON, SUMM, TONE to OUTPUT_ defines
+        captureState = CAPTURE_START;
+    }else if(!on && CAPTURE_OFF != captureState){
+        stop_Continuous_ADC();
+        captureState = CAPTURE_OFF;
+    }
+    return SHELL_OK;
+}
+
+int command_Rate(char * args, int query){
+    long value;
+    if(query){
+        sprintf(reply, "%u", captureRate);
+        reply_Shell(reply);
+        return SHELL_OK;
+    }
+    if(CAPTURE_OFF != captureState){        // Takes effect on next CAPT ON
+        return SHELL_BUSY;
+    }
+    if(number_Shell(get_Token_UART(&args), &value) ||
+       ADC_MIN_RATE > value || ADC_MAX_RATE/captureChannels < value){
+        return SHELL_BAD_ARGUMENT;
+    }
+    captureRate = (unsigned int)value;
+    return SHELL_OK;
+}
+
+int command_Chan(char * args, int query){
+    unsigned char inputs[ADC_MAX_CHANNELS];
+    unsigned int count = 0, i;
+    char * token;
+    long value;
+    if(query){
+        reply[0] = 0;
+        for(i = 0; i < captureChannels; i++){
+            sprintf(reply + strlen(reply), i ? " %u" : "%u", captureInputs[i]);
+        }
+        reply_Shell(reply);
+        return SHELL_OK;
+    }
+    if(CAPTURE_OFF != captureState){        // Takes effect on next CAPT ON
+        return SHELL_BUSY;
+    }
+    while((token = get_Token_UART(&args)) != 0){
+        if(ADC_MAX_CHANNELS == count || number_Shell(token, &value) ||
+           value < 0 || ADC_INPUTS <= value){
+            return SHELL_BAD_ARGUMENT;
+        }
+        inputs[count++] = (unsigned char)value;
+    }
+    if(0 == count || ADC_MAX_RATE/count < captureRate){
+        return SHELL_BAD_ARGUMENT;
+    }
+    memcpy(captureInputs, inputs, count);
+    captureChannels = count;
+    return SHELL_OK;
+}
+
+int command_Meas(char * args, int query){
+    if(!query){
+        return SHELL_QUERY_ONLY;
+    }
+    if(CAPTURE_OFF != captureState || running_Pipeline()){  // ADC owned by capture or pipeline
+        return SHELL_BUSY;
+    }
+    run_ADC();
+    while(!hasNew_ADC());                   // Single conversion is a few us
+    sprintf(reply, "%d", get_mV_ADC());
+    reply_Shell(reply);
+    return SHELL_OK;
+}
+
+int command_Stat(char * args, int query){
+    if(!query){
+        return SHELL_QUERY_ONLY;
+    }
+    sprintf(reply, "baud=%lu err=%d tx_drop=%u rx_drop=%u rx_overrun=%u frame_drop=%u log_drop=%u adc_overrun=%u adc_lost=%u",
+            get_Baud_UART(), get_Baud_Error_UART(), overflow_UART(), rx_Dropped_UART(),
+            rx_Overrun_UART(), dropped_Stream(), dropped_Log(), overrun_ADC(), lost_Sample_ADC());
+    reply_Shell(reply);
+    return SHELL_OK;
+}
+
+int command_Echo(char * args, int query){
+    int on;
+    if(query){
+        return SHELL_NO_QUERY;
+    }
+    on = parse_On_Off(args);
+    if(on < 0){
+        return SHELL_BAD_ARGUMENT;
+    }
+    echo_UART(on);
+    return SHELL_OK;
+}
+
+int command_Cal(char * args, int query){
+    const CalData * cal = get_Calibration();
+    char * token = get_Token_UART(&args);
+    long mV;
+    if(query){
+        sprintf(reply, "gain=%d offset=%d dac=%s %s", cal->gain, cal->offset,
+                get_DAC_Calibration() ? "curve" : "ideal",
+                saved_Calibration() ? "saved" : "unsaved");
+        reply_Shell(reply);
+        return SHELL_OK;
+    }
+    if(0 == token){
+        return SHELL_BAD_ARGUMENT;
+    }
+    if(match_Shell(token, "SOLVE")){
+        return solve_Calibration() ? SHELL_BAD_ARGUMENT : SHELL_OK;
+    }
+    if(match_Shell(token, "DAC")){
+        LinearityResult result;
+        WaveData wave;
+        if(CAPTURE_OFF != captureState || running_Pipeline() || running_Generator()){
+            return SHELL_BUSY;              // ADC or DAC in use
+        }
+        if(run_Linearity(&result)){
+            return SHELL_BAD_ARGUMENT;      // Output stuck at a rail, not wired
+        }
+        get_Wave_Generator(&wave);          // Rebuild table through the new curve
+        set_Wave_Generator(&wave);
+        sprintf(reply, "gain=%d uV offset=%d uV inl=%u.%02u LSB at %u points=%u reversals=%u",
+                result.gain, result.offset, result.inl/100, result.inl%100,
+                result.inlCode, result.fitted, result.reversals);
+        reply_Shell(reply);
+        return SHELL_OK;
+    }
+    if(match_Shell(token, "SAVE")){
+        return save_Calibration() ? SHELL_BAD_ARGUMENT : SHELL_OK;
+    }
+    if(!match_Shell(token, "LOW") && !match_Shell(token, "HIGH")){
+        return SHELL_BAD_ARGUMENT;
+    }
+    if(number_Shell(get_Token_UART(&args), &mV)){
+        return SHELL_BAD_ARGUMENT;
+    }
+    if(CAPTURE_OFF != captureState || running_Pipeline()){  // ADC owned by capture or pipeline
+        return SHELL_BUSY;
+    }
+    {
+        unsigned int sum = 0, i;
+        for(i = 0; i < CAL_SAMPLES; i++){   // Average out noise for the reference
+            run_ADC();
+            while(!hasNew_ADC());
+            sum += get_Raw_ADC();
+        }
+        set_Point_Calibration(match_Shell(token, "HIGH"), sum >> (CAL_SAMPLE_SHIFT - CAL_POINT_BITS), (int)mV);
+    }
+    return SHELL_OK;
+}
+
+int command_Filt(char * args, int query){
+    const char * names[] = {"NONE", "FIR", "IIR"};         // FilterType enum order
+    char * token;
+    FilterType type;
+    unsigned int count;
+    long value = 0;
+
+    if(query){
+        get_Filter(&type, &count);
+        sprintf(reply, "%s %u", names[type], count);
+        reply_Shell(reply);
+        return SHELL_OK;
+    }
+    token = get_Token_UART(&args);
+    for(type = pass; type <= biquad; type++){
+        if(token && match_Shell(token, names[type])){
+            if(pass != type && number_Shell(get_Token_UART(&args), &value)){
+                return SHELL_BAD_ARGUMENT;
+            }
+            return apply_Filter(type, (unsigned int)value) ? SHELL_BAD_ARGUMENT : SHELL_OK;
+        }
+    }
+    return SHELL_BAD_ARGUMENT;
+}
+
+int command_Coef(char * args, int query){
+    long index, value;
+    char * token;
+    if(query){
+        return SHELL_NO_QUERY;
+    }
+    if(number_Shell(get_Token_UART(&args), &index) || index < 0 ||
+       0 == (token = get_Token_UART(&args))){
+        return SHELL_BAD_ARGUMENT;
+    }
+    do{                                     // Values go to consecutive indexes
+        if(number_Shell(token, &value) || load_Filter((unsigned int)index++, (int)value)){
+            return SHELL_BAD_ARGUMENT;
+        }
+    }while((token = get_Token_UART(&args)));
+    return SHELL_OK;
+}
+
+int command_Pipe(char * args, int query){
+    char * token;
+    long value;
+
+    if(query){
+        PipelineStats stats;
+        if(!running_Pipeline()){
+            reply_Shell("OFF");
+            return SHELL_OK;
+        }
+        stats_Pipeline(&stats);
+        sprintf(reply, "ON rate=%u n=%u avg=%u max=%u cycles latency=%u ns late=%u",
+                pipeRate, stats.samples,
+                stats.samples ? (unsigned int)(stats.cycleSum/stats.samples) : 0, stats.cycleMax,
+                (unsigned int)((unsigned long long)stats.latencyMax*1000000000/ADC_TIMER_CLOCK),
+                stats.late);
+        reply_Shell(reply);
+        return SHELL_OK;
+    }
+    token = get_Token_UART(&args);
+    if(token && match_Shell(token, "CLR")){
+        clear_Pipeline();
+        return SHELL_OK;
+    }
+    if(token && match_Shell(token, "OFF")){
+        if(running_Pipeline()){
+            stop_Pipeline();
+        }
+        return SHELL_OK;
+    }
+    if(!token || !match_Shell(token, "ON")){
+        return SHELL_BAD_ARGUMENT;
+    }
+    if(CAPTURE_OFF != captureState || running_Generator()){ // ADC or DAC in use
+        return SHELL_BUSY;
+    }
+    if((token = get_Token_UART(&args))){    // Optional rate, else last one
+        if(number_Shell(token, &value) || ADC_MIN_RATE > value || ADC_MAX_RATE < value){
+            return SHELL_BAD_ARGUMENT;
+        }
+        pipeRate = (unsigned int)value;
+    }
+    return start_Pipeline(pipeRate) ? SHELL_BAD_ARGUMENT : SHELL_OK;
+}
+
+int command_Tone(char * args, int query){
+    unsigned int freqs[GOERTZEL_MAX_TONES];
+    unsigned int count = 0, i;
+    char * token;
+    long value;
+
+    if(query){
+        char * text = reply;
+        for(i = 0; i < toneCount; i++){
+            text += sprintf(text, i ? " %u" : "%u", toneFreqs[i]);
+        }
+        reply_Shell(reply);
+        return SHELL_OK;
+    }
+    if(CAPTURE_OFF != captureState){        // Takes effect on next CAPT TONE
+        return SHELL_BUSY;
+    }
+    while((token = get_Token_UART(&args))){
+        if(GOERTZEL_MAX_TONES == count || number_Shell(token, &value) ||
+           value <= 0 || check_Goertzel((unsigned int)value, captureRate, ADC_BLOCK_SIZE/captureChannels)){
+            return SHELL_BAD_ARGUMENT;      // CAPT TONE checks again in case RATE or CHAN change
+        }
+        freqs[count++] = (unsigned int)value;
+    }
+    if(0 == count){
+        return SHELL_BAD_ARGUMENT;
+    }
+    for(i = 0; i < count; i++){
+        toneFreqs[i] = freqs[i];
+    }
+    toneCount = count;
+    return SHELL_OK;
+}
+
+int command_Prof(char * args, int query){
+#if PROFILE_ENABLE
+    ProfileStats stats;
+    ProfileProbe probe;
+    char * token;
+    if(!query){
+        token = get_Token_UART(&args);
+        if(token && match_Shell(token, "CLR")){
+            clear_Profile();
+            return SHELL_OK;
+        }
+        return SHELL_BAD_ARGUMENT;
+    }
+    for(probe = (ProfileProbe)0; probe < PROFILE_PROBES; probe++){   // One line per probe
+        get_Profile(probe, &stats);
+        sprintf(reply, "%s n=%u min=%u max=%u avg=%u cycles", name_Profile(probe), stats.count,
+                stats.count ? stats.min : 0, stats.max,
+                stats.count ? (unsigned int)(stats.total/stats.count) : 0);
+        reply_Shell(reply);
+    }
+    sprintf(reply, "overhead=%u cycles, included above", overhead_Profile());
+    reply_Shell(reply);
+    return SHELL_OK;
+#else
+    if(!query){
+        return SHELL_BAD_ARGUMENT;         // Nothing to clear
+    }
+    reply_Shell("OFF, build with PROFILE_ENABLE 1");
+    return SHELL_OK;
+#endif
+}
@@ -83,6 +83,7 @@ SECTIONS
     .pinit  :   > MAIN
     .init_array   :     > MAIN
     .binit        : {}  > MAIN
+    .logstr       :     > MAIN      /* Log format strings, see Log.h */
 
     /* The following sections show the usage of the INFO flash memory        */
     /* INFO flash memory is intended to be used for the following            */
@@ -0,0 +1,137 @@
+/*
+ *  Fixed_Math.c
+ *    This holds the table and bit by bit fixed point functions
+ *    See Fixed_Math.h for more details
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Fixed_Math.h"
+
+#define QUARTER_BITS    14                                  // Phase bits inside a quarter turn
+#define SIN_FRACTION    (QUARTER_BITS - FIXED_SIN_BITS)     // Phase bits between entries
+
+/* sin_Fixed()
+ *  Quarter wave table mirrored to the full turn, linear between entries
+ *
+ * Parameters:
+ *  phase - Low 16 bits used, FIXED_TURN is one turn
+ *
+ * Returns:
+ *  Q15 sine, -32767 to 32767
+ */
+int sin_Fixed(unsigned int phase){
+    unsigned int quadrant = (phase >> QUARTER_BITS) & 3;
+    unsigned int offset = phase & ((1 << QUARTER_BITS) - 1);
+    unsigned int index, fraction;
+    int value;
+
+    if(quadrant & 1){                                       // Falling half of each half turn
+        offset = (1 << QUARTER_BITS) - offset;
+    }
+    index    = offset >> SIN_FRACTION;
+    fraction = offset & ((1 << SIN_FRACTION) - 1);
+    value    = FIXED_SIN[ index ];
+    if(fraction){                                           // Index is below the last entry
+        value += ((FIXED_SIN[ index + 1 ] - value)*(int)fraction + (1 << (SIN_FRACTION - 1))) >> SIN_FRACTION;
+    }
+    return (quadrant & 2) ? -value : value;
+}
+
+int cos_Fixed(unsigned int phase){
+    return sin_Fixed(phase + FIXED_TURN/4);
+}
+
+/* sqrt_Fixed()
+ *  Bit by bit, one result bit per step from the highest set
+ *
+ * Returns:
+ *  Square root rounded down
+ */
+unsigned int sqrt_Fixed(unsigned int value){
+    unsigned int root = 0;
+    unsigned int bit = 1u << 30;
+    while(bit > value){
+        bit >>= 2;
+    }
+    while(bit){
+        if(value >= root + bit){
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }else{
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+unsigned int sqrt64_Fixed(unsigned long long value){
+    unsigned long long root = 0;
+    unsigned long long bit = 1ULL << 62;
+    if(value <= 0xFFFFFFFF){                                // Stay in 32 bit math when possible
+        return sqrt_Fixed((unsigned int)value);
+    }
+    while(bit > value){
+        bit >>= 2;
+    }
+    while(bit){
+        if(value >= root + bit){
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }else{
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (unsigned int)root;
+}
+
+/* log2_Fixed()
+ *  Integer part from the highest set bit, fraction from the octave table
+ *
+ * Parameters:
+ *  value - Integer, or Q format with its fraction bits taken off the result
+ *
+ * Returns:
+ *  Q16 log2, FIXED_LOG2_ZERO for 0
+ */
+int log2_Fixed(unsigned int value){
+    int exponent = 31;
+    unsigned int index, fraction;
+    int result;
+
+    if(0 == value){
+        return FIXED_LOG2_ZERO;
+    }
+    //Normalize so bit 31 is set, binary search for the shift
+    if(!(value & 0xFFFF0000)){ value <<= 16; exponent -= 16; }
+    if(!(value & 0xFF000000)){ value <<= 8;  exponent -= 8;  }
+    if(!(value & 0xF0000000)){ value <<= 4;  exponent -= 4;  }
+    if(!(value & 0xC0000000)){ value <<= 2;  exponent -= 2;  }
+    if(!(value & 0x80000000)){ value <<= 1;  exponent -= 1;  }
+
+    index    = (value >> (31 - FIXED_LOG2_BITS)) & (FIXED_LOG2_LENGTH - 1);
+    fraction = (value >> (15 - FIXED_LOG2_BITS)) & 0xFFFF;  // Next 16 bits
+    result   = (int)FIXED_LOG2[ index ] +
+               (int)((((FIXED_LOG2[ index + 1 ] - FIXED_LOG2[ index ])*fraction) + 0x8000) >> 16);
+    return (exponent << 16) + result;
+}
+
+/* recip_Fixed()
+ *  One divide so later divides by the same value are multiplies
+ *
+ * Parameters:
+ *  divisor - 1 or more
+ *
+ * Returns:
+ *  Reciprocal for divide_Fixed, (2^32-1)/divisor
+ */
+unsigned int recip_Fixed(unsigned int divisor){
+    return 0xFFFFFFFF/divisor;
+}
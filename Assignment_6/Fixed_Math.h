@@ -0,0 +1,101 @@
+/*
+ * Fixed_Math.h
+ *
+ *   This libary holds integer replacements for math.h in sample paths
+ *      sin_Fixed     - Q15 sine of a 16 bit phase, table and interpolation
+ *      cos_Fixed     - Q15 cosine of a 16 bit phase
+ *      sqrt_Fixed    - Integer square root of 32 bit value
+ *      sqrt64_Fixed  - Integer square root of 64 bit value
+ *      log2_Fixed    - Q16 base 2 log of an integer
+ *      recip_Fixed   - Q32 reciprocal for repeated divides by one value
+ *      divide_Fixed  - Divides by a recip_Fixed reciprocal, one multiply
+ *      sat_Fixed     - Clamps to Q15
+ *      add_Fixed     - Saturating Q15 add
+ *      sub_Fixed     - Saturating Q15 subtract
+ *      mul_Fixed     - Rounded saturating Q15 multiply
+ *      add31_Fixed   - Saturating Q31 add
+ *      mul31_Fixed   - Rounded saturating Q31 multiply
+ *
+ *   Phase is one turn per 2^16, the top 16 bits of a 32 bit phase
+ *   accumulator. Sine interpolates a FIXED_SIN_LENGTH entry quarter wave,
+ *   error is about 1 LSB. log2 interpolates a FIXED_LOG2_LENGTH entry
+ *   octave, error is under 4 Q16 LSB (0.0004 dB as 20*log10).
+ *
+ *   divide_Fixed(x, recip_Fixed(d)) is exactly x/d for x and d under 2^16,
+ *   use a real divide past that. Tables are const in flash (Fixed_Tables.c),
+ *   regenerate with Host_Tools/gen_fixed_tables.py after changing sizes.
+ *   Assignment_6 times and checks each against math.h.
+ *
+ * Depenedencies:
+ *   None
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef FIXED_MATH_H_
+#define FIXED_MATH_H_
+
+#define FIXED_SIN_BITS      8
+#define FIXED_SIN_LENGTH    (1 << FIXED_SIN_BITS)   // Entries per quarter turn
+#define FIXED_LOG2_BITS     6
+#define FIXED_LOG2_LENGTH   (1 << FIXED_LOG2_BITS)  // Entries per octave
+#define FIXED_LOG2_ZERO     (-0x7FFFFFFF - 1)       // log2_Fixed(0)
+#define FIXED_TURN          0x10000                 // Phase of one full turn
+
+extern const short FIXED_SIN[ FIXED_SIN_LENGTH + 1 ];
+extern const unsigned int FIXED_LOG2[ FIXED_LOG2_LENGTH + 1 ];
+
+int sin_Fixed(unsigned int phase);
+int cos_Fixed(unsigned int phase);
+unsigned int sqrt_Fixed(unsigned int value);
+unsigned int sqrt64_Fixed(unsigned long long value);
+int log2_Fixed(unsigned int value);
+unsigned int recip_Fixed(unsigned int divisor);
+
+/* divide_Fixed()
+ *
+ * Parameters:
+ *  value - Dividend
+ *  recip - recip_Fixed of the divisor
+ *
+ * Returns:
+ *  value/divisor, rounded down, exact when both are under 2^16
+ */
+static inline unsigned int divide_Fixed(unsigned int value, unsigned int recip){
+    return (unsigned int)(((unsigned long long)value*recip + value) >> 32);
+}
+
+static inline int sat_Fixed(int value){
+    return (value > 32767) ? 32767 : (value < -32768) ? -32768 : value;
+}
+
+static inline int add_Fixed(int a, int b){
+    return sat_Fixed(a + b);
+}
+
+static inline int sub_Fixed(int a, int b){
+    return sat_Fixed(a - b);
+}
+
+static inline int mul_Fixed(int a, int b){
+    return sat_Fixed((a*b + 0x4000) >> 15);                 // Only -1 * -1 saturates
+}
+
+static inline int add31_Fixed(int a, int b){
+    long long sum = (long long)a + b;
+    return (sum > 0x7FFFFFFF) ? 0x7FFFFFFF : (sum < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : (int)sum;
+}
+
+static inline int mul31_Fixed(int a, int b){
+    long long product = ((long long)a*b + 0x40000000) >> 31;
+    return (product > 0x7FFFFFFF) ? 0x7FFFFFFF : (int)product;  // Only -1 * -1 saturates
+}
+
+#endif /* FIXED_MATH_H_ */
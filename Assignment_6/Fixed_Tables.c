@@ -0,0 +1,58 @@
+/*
+ *  Fixed_Tables.c
+ *    Tables for Fixed_Math.c, generated by Host_Tools/gen_fixed_tables.py
+ *    Do not edit, rerun the script instead
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Fixed_Math.h"
+
+//Q15 sine of the first quarter turn, entry i is sin(pi/2*i/FIXED_SIN_LENGTH)
+const short FIXED_SIN[ 257 ] = {
+         0,    201,    402,    603,    804,   1005,   1206,   1407,
+      1608,   1809,   2009,   2210,   2411,   2611,   2811,   3012,
+      3212,   3412,   3612,   3812,   4011,   4211,   4410,   4609,
+      4808,   5007,   5205,   5404,   5602,   5800,   5998,   6195,
+      6393,   6590,   6787,   6983,   7180,   7376,   7571,   7767,
+      7962,   8157,   8351,   8546,   8740,   8933,   9127,   9319,
+      9512,   9704,   9896,  10088,  10279,  10469,  10660,  10850,
+     11039,  11228,  11417,  11605,  11793,  11980,  12167,  12354,
+     12540,  12725,  12910,  13095,  13279,  13463,  13646,  13828,
+     14010,  14192,  14373,  14553,  14733,  14912,  15091,  15269,
+     15447,  15624,  15800,  15976,  16151,  16326,  16500,  16673,
+     16846,  17018,  17190,  17361,  17531,  17700,  17869,  18037,
+     18205,  18372,  18538,  18703,  18868,  19032,  19195,  19358,
+     19520,  19681,  19841,  20001,  20160,  20318,  20475,  20632,
+     20788,  20943,  21097,  21251,  21403,  21555,  21706,  21856,
+     22006,  22154,  22302,  22449,  22595,  22740,  22884,  23028,
+     23170,  23312,  23453,  23593,  23732,  23870,  24008,  24144,
+     24279,  24414,  24548,  24680,  24812,  24943,  25073,  25202,
+     25330,  25457,  25583,  25708,  25833,  25956,  26078,  26199,
+     26320,  26439,  26557,  26674,  26791,  26906,  27020,  27133,
+     27246,  27357,  27467,  27576,  27684,  27791,  27897,  28002,
+     28106,  28209,  28311,  28411,  28511,  28610,  28707,  28803,
+     28899,  28993,  29086,  29178,  29269,  29359,  29448,  29535,
+     29622,  29707,  29792,  29875,  29957,  30038,  30118,  30196,
+     30274,  30350,  30425,  30499,  30572,  30644,  30715,  30784,
+     30853,  30920,  30986,  31050,  31114,  31177,  31238,  31298,
+     31357,  31415,  31471,  31527,  31581,  31634,  31686,  31737,
+     31786,  31834,  31881,  31927,  31972,  32015,  32058,  32099,
+     32138,  32177,  32214,  32251,  32286,  32319,  32352,  32383,
+     32413,  32442,  32470,  32496,  32522,  32546,  32568,  32590,
+     32610,  32629,  32647,  32664,  32679,  32693,  32706,  32718,
+     32729,  32738,  32746,  32753,  32758,  32762,  32766,  32767,
+     32767
+};
+
+//Q16 log2(1 + i/FIXED_LOG2_LENGTH), one octave
+const unsigned int FIXED_LOG2[ 65 ] = {
+         0,   1466,   2909,   4331,   5732,   7112,   8473,   9814,
+     11136,  12440,  13727,  14996,  16248,  17484,  18704,  19909,
+     21098,  22272,  23433,  24579,  25711,  26830,  27936,  29029,
+     30109,  31178,  32234,  33279,  34312,  35334,  36346,  37346,
+     38336,  39316,  40286,  41246,  42196,  43137,  44068,  44990,
+     45904,  46809,  47705,  48593,  49472,  50344,  51207,  52063,
+     52911,  53751,  54584,  55410,  56229,  57040,  57845,  58643,
+     59434,  60219,  60997,  61769,  62534,  63294,  64047,  64794,
+     65536
+};
@@ -0,0 +1,55 @@
+/*
+ * Ring_Buffer.h
+ *
+ *   This libary holds a single producer/single consumer ring buffer
+ *      init_Ring     - Attaches storage to a ring, length must be a power of two
+ *      used_Ring     - Returns number of bytes waiting in the ring
+ *      free_Ring     - Returns number of bytes that can still be written
+ *      put_Ring      - Adds a single byte to the ring
+ *      get_Ring      - Removes a single byte from the ring
+ *      write_Ring    - Copies a block of bytes into the ring
+ *      read_Ring     - Copies a block of bytes out of the ring
+ *      flush_Ring    - Drops all waiting bytes (consumer side only)
+ *      overflow_Ring - Returns number of bytes dropped because the ring was full
+ *
+ *   Indexes are free running and masked on access so no division is needed.
+ *   Only the producer writes head/overflow and only the consumer writes tail,
+ *   so one side may be an ISR without disabling interrupts.
+ *
+ * Depenedencies:
+ *   string.h - memcpy for block copies
+ *
+ * Errors:
+ *   None Currently Oct 19, 2026
+ *
+ * Revisions:
+ *   Oct 19, 2026 - Initial Creation
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ *
+ */
+
+#ifndef RING_BUFFER_H_
+#define RING_BUFFER_H_
+#include <string.h>
+
+//Data struct for a ring, storage is supplied by the owner
+typedef struct{
+    char *                data;         // Storage, length must be a power of two
+    unsigned int          mask;         // Length - 1, used in place of modulo
+    volatile unsigned int head;         // Free running write count (producer)
+    volatile unsigned int tail;         // Free running read count  (consumer)
+    volatile unsigned int overflow;     // Bytes dropped while full  (producer)
+}RingBuffer;
+
+int          init_Ring(RingBuffer * ring, char * data, unsigned int length);
+unsigned int used_Ring(const RingBuffer * ring);
+unsigned int free_Ring(const RingBuffer * ring);
+int          put_Ring(RingBuffer * ring, char data);
+int          get_Ring(RingBuffer * ring, char * data);
+unsigned int write_Ring(RingBuffer * ring, const char * data, unsigned int length);
+unsigned int read_Ring(RingBuffer * ring, char * data, unsigned int length);
+void         flush_Ring(RingBuffer * ring);
+unsigned int overflow_Ring(const RingBuffer * ring);
+
+#endif /* RING_BUFFER_H_ */
@@ -0,0 +1,331 @@
+/*
+ *  UART.C
+ *    This holds the internal functions for UART and protected values
+ *    See UART.h for more details
+ *  
+ * Errors:
+ *   None Currently May 5, 2017
+ *
+ * Revisions:
+ *   May 5,  2017 - Initial Creation
+ *   Oct 19, 2026 - TX moved onto power-of-two ring buffer with overflow count
+ *   Oct 19, 2026 - RX ring, ISR only stores bytes, line reader in thread context
+ *   Oct 19, 2026 - Float divider and BRS if-chain replaced by integer search
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "UART.h"
+
+static char TX_DATA[ UART_BUFFER_LENGTH ];
+static RingBuffer TX_BUFFER;
+static volatile int txRunning;                              // Set while TX interrupt is draining ring
+static char RX_DATA[ UART_BUFFER_LENGTH ];
+static RingBuffer RX_BUFFER;
+static volatile unsigned int rxOverrun;                     // Bytes lost in hardware before ISR ran
+
+static int DACValueOut;
+static char DAC_TEXT[ UART_LINE_LENGTH ];
+static LineBuffer dacLine;                                  // Line being read by hasNewValue
+
+static BaudConfig activeBaud;                               // Divider currently in use
+
+static void start_TX_UART(void);
+
+/* calculate_Baud_UART()
+ *  Finds BRW/BRF/BRS for a clock and baud using integer math only.
+ *  BRW and BRF come straight from the divider (UART_BRW/UART_BRF), BRS is
+ *  picked by trying all 256 patterns and keeping the one with the smallest
+ *  worst case TX bit timing error over a 10 bit frame (start, 8 data, stop).
+ *
+ * Parameters:
+ *  clock  - BRCLK frequency in Hz
+ *  baud   - Desired baud rate
+ *  config - Filled with register values, achieved baud and error
+ *
+ * Errors:
+ *  None Currently - Oct 19, 2026
+ */
+void calculate_Baud_UART(unsigned long clock, unsigned long baud, BaudConfig * config){
+    unsigned int bitCycles = UART_OS16(clock, baud) ?           // BRCLK cycles per bit before BRS
+                             16*UART_BRW(clock, baud) + UART_BRF(clock, baud) :
+                             UART_BRW(clock, baud);
+    long long bestError = -1;
+    long long bestSigned = 0;
+    unsigned int bestPattern = 0;
+    unsigned int pattern, bit;
+
+    for(pattern = 0; pattern < 256; pattern++){
+        long long worst = 0, worstSigned = 0;
+        unsigned long long cycles = 0;
+        for(bit = 0; bit < UART_FRAME_BITS; bit++){
+            long long error;
+            cycles += bitCycles + ((pattern >> (bit & 7)) & 1); // BRS bit 0 applies to start bit
+            //Error in BRCLK cycles scaled by baud, divide by clock for fraction of a bit
+            error = (long long)(cycles*baud) - (long long)(bit + 1)*clock;
+            if((error < 0 ? -error : error) > worst){
+                worst = error < 0 ? -error : error;
+                worstSigned = error;
+            }
+        }
+        if(bestError < 0 || worst < bestError){             // Keep smallest worst case
+            bestError   = worst;
+            bestSigned  = worstSigned;
+            bestPattern = pattern;
+        }
+    }
+
+    config->brw   = UART_BRW(clock, baud);
+    config->mctlw = (bestPattern << EUSCI_A_MCTLW_BRS_OFS) |
+                    (UART_BRF(clock, baud) << EUSCI_A_MCTLW_BRF_OFS) |
+                    (UART_OS16(clock, baud) ? EUSCI_A_MCTLW_OS16 : 0);
+    config->error = (int)((bestSigned*10000)/(long long)clock); // 0.01% of a bit
+    {
+        unsigned int ones = 0;                              // Average cycles per bit over 8 bit pattern
+        for(bit = 0; bit < 8; bit++){
+            ones += (bestPattern >> bit) & 1;
+        }
+        config->baud = (unsigned long)(((unsigned long long)clock*8)/(8*bitCycles + ones));
+    }
+}
+
+unsigned long get_Baud_UART(void){
+    return activeBaud.baud;                                 // Baud actually generated
+}
+
+int get_Baud_Error_UART(void){
+    return activeBaud.error;                                // Worst bit error, 0.01% units
+}
+
+void init_UART(unsigned int baud){
+
+    EUSCI_A0->CTLW0 |= EUSCI_A_CTLW0_SWRST; // Reset USCI
+    init_Ring(&TX_BUFFER, TX_DATA, UART_BUFFER_LENGTH);
+    init_Ring(&RX_BUFFER, RX_DATA, UART_BUFFER_LENGTH);
+    txRunning = 0;
+    rxOverrun = 0;
+    init_Line_UART(&dacLine, DAC_TEXT, UART_LINE_LENGTH);
+
+    //Integer divider and modulation search, see calculate_Baud_UART
+    calculate_Baud_UART(F_CPU, baud, &activeBaud);
+    EUSCI_A0->BRW   = activeBaud.brw;
+    EUSCI_A0->MCTLW = activeBaud.mctlw;
+
+    //Select MCLK
+    EUSCI_A0->CTLW0 |= EUSCI_A_CTLW0_SSEL__SMCLK;
+
+    //Configure pins
+    P1->SEL0 |=  (BIT3 | BIT2);
+    P1->SEL1 &= ~(BIT3 | BIT2);
+    //End reset
+    EUSCI_A0->CTLW0 &= ~EUSCI_A_CTLW0_SWRST;
+
+    //Enable interupts
+    EUSCI_A0->IFG   = 0;
+    EUSCI_A0->IE |= EUSCI_A_IE_TXCPTIE | EUSCI_A_IE_RXIE;
+    NVIC->ISER[0] = 1 << ((EUSCIA0_IRQn) & 31);
+
+
+}
+
+//////////////////////////////////////////////////////////////////////
+//                   Receive, thread context only                   //
+//////////////////////////////////////////////////////////////////////
+int  available_UART(void){
+    return used_Ring(&RX_BUFFER);                           // Bytes waiting in RX ring
+}
+
+char read_Char_UART(void){
+    char tempValue = 0;
+    get_Ring(&RX_BUFFER, &tempValue);                       // Left 0 if nothing waiting
+    return tempValue;
+}
+
+void flush_RX_UART(void){
+    flush_Ring(&RX_BUFFER);                                 // Drop everything waiting
+}
+
+unsigned int rx_Dropped_UART(void){
+    return overflow_Ring(&RX_BUFFER);                       // Bytes lost because RX ring was full
+}
+
+unsigned int rx_Overrun_UART(void){
+    return rxOverrun;                                       // Bytes lost before ISR read RXBUF
+}
+
+/* init_Line_UART()
+ *  Attaches storage to a line reader and empties it
+ *
+ * Parameters:
+ *  line   - Reader state, owned by the caller
+ *  text   - Storage for the line, kept as long as the reader is used
+ *  length - Size of text, at least 1 for the terminator
+ *
+ * Returns:
+ *  0  - Reader ready
+ *  -1 - No storage, read_Line_UART will never return a line
+ */
+int init_Line_UART(LineBuffer * line, char * text, unsigned int length){
+    line->text   = text;
+    line->length = text ? length : 0;
+    line->index  = 0;
+    return line->length ? 0 : -1;
+}
+
+/* read_Line_UART()
+ *  Builds a line from waiting RX bytes and echoes them, never blocks.
+ *  Line is kept in the reader between calls until carriage return or
+ *  newline arrives. Characters past length-1 are dropped, line is always
+ *  null terminated.
+ *
+ * Parameters:
+ *  line - Reader set up by init_Line_UART
+ *
+ * Returns:
+ *  1 - Full line is in line->text
+ *  0 - Line not finished yet, or reader has no storage
+ */
+int read_Line_UART(LineBuffer * line){
+    char input;
+    if(0 == line->length){                                  // No room for a terminator
+        return 0;
+    }
+    while(get_Ring(&RX_BUFFER, &input)){                    // Use everything waiting
+        if(input == 13 || input == '\n'){                   // End of line
+            print_Char_UART('\n');                          // Make it show up cleanly on terminal
+            line->text[line->index] = 0;
+            line->index = 0;
+            return 1;
+        }
+        print_Char_UART(input);                             // Echo input
+        if(line->index < line->length - 1){                 // Keep room for terminator
+            line->text[line->index++] = input;
+        }
+    }
+    return 0;
+}
+
+/* get_Token_UART()
+ *  Splits a line into space separated tokens in place
+ *
+ * Parameters:
+ *  cursor - Position in line, updated past the returned token
+ *
+ * Returns:
+ *  Pointer to null terminated token, 0 if no tokens remain
+ */
+char * get_Token_UART(char ** cursor){
+    char * token = *cursor;
+    while(*token == ' ' || *token == '\t'){                 // Skip leading spaces
+        token++;
+    }
+    if(0 == *token){                                        // End of line
+        *cursor = token;
+        return 0;
+    }
+    *cursor = token;
+    while(**cursor != 0 && **cursor != ' ' && **cursor != '\t'){
+        (*cursor)++;                                        // Find end of token
+    }
+    if(**cursor != 0){                                      // Terminate and step past it
+        **cursor = 0;
+        (*cursor)++;
+    }
+    return token;
+}
+
+/* start_TX_UART()
+ *  Loads first byte and enables TX complete interrupt if ISR is idle.
+ *  ISR only goes idle once ring is empty, so this never races it.
+ */
+static void start_TX_UART(void){
+    char data;
+    if(!txRunning && get_Ring(&TX_BUFFER, &data)){          // Idle and data waiting
+        txRunning = 1;                                      // ISR now owns the ring tail
+        EUSCI_A0->IFG  &= ~EUSCI_A_IFG_TXCPTIFG;            // Clear interrupt flag
+        EUSCI_A0->TXBUF = data;                             // Send char to UART buffer
+        EUSCI_A0->IE   |= EUSCI_A_IE_TXCPTIE;               // Enable TX complete interrupt
+    }
+}
+
+int print_Char_UART(char data){
+    int added = put_Ring(&TX_BUFFER, data);                 // Load data, dropped if full
+    start_TX_UART();                                        // Kick ISR if it was idle
+    return added;
+}
+
+int print_String_UART(const char* data){
+    int added = write_Ring(&TX_BUFFER, data, strlen(data)); // Copy what fits, rest is counted
+    start_TX_UART();                                        // Kick ISR if it was idle
+    return added;
+}
+
+unsigned int overflow_UART(void){
+    return overflow_Ring(&TX_BUFFER);                       // Bytes dropped because ring was full
+}
+
+void EUSCIA0_IRQHandler(void){
+    //////////////////////////////////////////////////////////
+    //                  Receive Handler                     //
+    //////////////////////////////////////////////////////////
+    if(EUSCI_A0->IFG & EUSCI_A_IFG_RXIFG){                  // If flag is for RX
+        if(EUSCI_A0->STATW & EUSCI_A_STATW_OE){             // Byte lost before this one was read
+            rxOverrun++;
+        }
+        put_Ring(&RX_BUFFER, EUSCI_A0->RXBUF);              // Store only, reading clears RX flag
+    }
+
+    //////////////////////////////////////////////////////////
+    //                  Transmit Handler                    //
+    //////////////////////////////////////////////////////////
+    if(EUSCI_A0->IFG & EUSCI_A_IFG_TXCPTIFG){
+        char data;
+        EUSCI_A0->IFG   &= ~EUSCI_A_IFG_TXCPTIFG;           // Clear flag
+        if(get_Ring(&TX_BUFFER, &data)){                    // If more data waiting
+            EUSCI_A0->TXBUF = data;                         // Load data to UART TX buffer
+        }else{                                              // Else no more data
+            EUSCI_A0->IE &= ~EUSCI_A_IE_TXCPTIE;            // Stop interrupt
+            txRunning = 0;                                  // Hand ring back to producer
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+//                  Only exists for assignment 7                    //
+//////////////////////////////////////////////////////////////////////
+int  getDACValue(void){
+    return DACValueOut;                                     // Return value
+}
+
+/* hasNewValue()
+ *  Reads a line and checks it holds a single value 0-4095
+ *
+ * Returns:
+ *  1 - New value ready from getDACValue
+ *  0 - No line yet or line rejected
+ */
+int  hasNewValue(void){
+    char * cursor = DAC_TEXT;
+    char * token;
+    int value = 0;
+
+    if(!read_Line_UART(&dacLine)){                          // Line not finished
+        return 0;
+    }
+    token = get_Token_UART(&cursor);
+    if(0 == token || 0 != get_Token_UART(&cursor)){         // Need exactly one token
+        return 0;
+    }
+    while(*token){
+        if('0' > *token || '9' < *token){                   // Bad character throw out number
+            print_Char_UART('\n');                          // Rejection indicator
+            return 0;
+        }
+        value = value*10 + (*token++ - '0');                // Convert char to int add to value
+        if(4096 <= value){                                  // Sanity check value
+            print_Char_UART('\n');                          // Rejection indicator
+            return 0;
+        }
+    }
+    DACValueOut = value;                                    // Set value to be output
+    return 1;
+}
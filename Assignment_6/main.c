@@ -5,15 +5,37 @@
  *    how differences in how code is written affect overall
  *    speed.
  *
+ *    Every operation is timed for every type in one image with the DWT
+ *    cycle counter and the table is printed over UART at BAUD. Each case
+ *    loads its operands from volatiles, does the operation and stores the
+ *    result to a volatile between two counter reads. The same case with
+ *    no operation is the overhead taken off. Each case is run BENCH_RUNS
+ *    times and the fewest cycles kept, flash wait states make the first
+ *    run slower.
+ *
+ *    Operands come from volatiles so division is a real divide, not a
+ *    multiply by a constant reciprocal. Fixed is Q16.16 in an int except
+ *    sin, Q15 of a 16 bit phase, and log2, Q16 of an integer (Fixed_Math).
+ *    '-' marks operations with no fixed point version. A second table is
+ *    the worst error of each Fixed_Math function against math.h.
+ *
  *    Dependencies:
  *      msp.h   - Access to pins on board
  *      math.h  - Access to abs, sqrt, sin, and sinh
+ *      stdio.h - Formatting table rows
+ *      Clocks.h - CPU frequency
+ *      UART.h  - Results output
+ *      Cycles.h - DWT cycle counter
+ *      Fixed_Math.h - Fixed point functions under test, copy of ADC_Reading's
  *
  *    Errors:
- *      None Currently Apr 26, 2017
+ *      None Currently Oct 19, 2026
  *
  *    Revisions:
  *      Apr 26,  2017 - Initial Creation
+ *      Oct 19,  2026 - Cycle counted table of every operation and type over UART,
+ *                      replaces LED timing of one operation per build
+ *      Oct 19,  2026 - Fixed_Math timing, log2 row and accuracy table
  *
  *    Authors:
  *      Jordan Jones
@@ -25,66 +47,251 @@
 /////////////////////////////////////////////////////////////////////// 
 #include "msp.h"
 #include "math.h"
+#include "stdlib.h"
+#include "stdio.h"
+#include "Clocks.h"
+#include "UART.h"
+#include "Cycles.h"
+#include "Fixed_Math.h"
 
 ///////////////////////////////////////////////////////////////////////
 //                        Mode Defines (DO NOT EDIT)                 //
 ///////////////////////////////////////////////////////////////////////
-#define SUBROUTINE 
-#define N          x = n;
-#define N_PLUS_1   x = n + 1;
-#define N_PLUS_7   x = n + 7;
-#define N_MULT_2   x = n * 2;
-#define N_MULT_3   x = n * 3;
-#define N_DIV_2    x = n / 2;
-#define N_DIV_3    x = n / 3;
-#define SIN(N)     x = sin(n);
-#define SINH(N)    x = sinh(n);
-#define SQRT(N)    x = sqrt(n);
-#define ABS(N)     x = abs(n);
+#define FIX_BITS        16                      // Q16.16 fixed point
+#define FIX(x)          ((int)((x)*(1 << FIX_BITS)))
+#define FIX_MUL(a, b)   ((int)(((long long)(a)*(b)) >> FIX_BITS))
+#define FIX_DIV(a, b)   ((int)(((long long)(a) << FIX_BITS)/(b)))
 
+//BENCH(name, type, a, b, expression of n and m)
+//Makes name(), returns cycles of one pass of expression between counter reads
+#define BENCH(name, type, a, b, expression)                     \
+static unsigned int name(void){                                 \
+    static volatile type in[2] = {(a), (b)};                    \
+    static volatile type out;                                   \
+    type n, m;                                                  \
+    unsigned int start, stop;                                   \
+    start = get_Cycles();                                       \
+    n = in[0];                                                  \
+    m = in[1];                                                  \
+    out = (type)(expression);                                   \
+    stop = get_Cycles();                                        \
+    (void)m;                                                    \
+    return stop - start;                                        \
+}
 
 ///////////////////////////////////////////////////////////////////////
 //                        Running mode (EDITABLE)                    //
 ///////////////////////////////////////////////////////////////////////
+#define BAUD            115200
+#define BENCH_RUNS      8                       // Runs per case, fewest cycles kept
+#define PHASE           0x2345                  // Fixed sin input, 49.6 degrees
+
+typedef unsigned int (*Bench)(void);
+
+//Overhead of each type, operation replaced with a copy
+BENCH(none_Int,    int,    15,       3,      n)
+BENCH(none_Float,  float,  15.0f,    3.0f,   n)
+BENCH(none_Double, double, 15.0,     3.0,    n)
+BENCH(none_Q16,    int,    FIX(15),  FIX(3), n)
+
+BENCH(add_Int,     int,    15,       3,      n + m)
+BENCH(add_Float,   float,  15.0f,    3.0f,   n + m)
+BENCH(add_Double,  double, 15.0,     3.0,    n + m)
+BENCH(add_Q16,     int,    FIX(15),  FIX(3), n + m)
+
+BENCH(mul_Int,     int,    15,       3,      n * m)
+BENCH(mul_Float,   float,  15.0f,    3.0f,   n * m)
+BENCH(mul_Double,  double, 15.0,     3.0,    n * m)
+BENCH(mul_Q16,     int,    FIX(15),  FIX(3), FIX_MUL(n, m))
+
+BENCH(div_Int,     int,    15,       3,      n / m)
+BENCH(div_Float,   float,  15.0f,    3.0f,   n / m)
+BENCH(div_Double,  double, 15.0,     3.0,    n / m)
+BENCH(div_Q16,     int,    FIX(15),  FIX(3), FIX_DIV(n, m))
 
-//Select datatype for operations
-#define VAR_TYPE    double
+BENCH(sin_Int,     int,    15,       3,      sin(n))
+BENCH(sin_Float,   float,  15.0f,    3.0f,   sinf(n))
+BENCH(sin_Double,  double, 15.0,     3.0,    sin(n))
+BENCH(sin_Q15,     int,    PHASE,    3,      sin_Fixed(n))
 
-//Select operation
-#define OPERATION        ABS(N)
+BENCH(sinh_Int,    int,    15,       3,      sinh(n))
+BENCH(sinh_Float,  float,  15.0f,    3.0f,   sinhf(n))
+BENCH(sinh_Double, double, 15.0,     3.0,    sinh(n))
 
+BENCH(sqrt_Int,    int,    15,       3,      sqrt(n))
+BENCH(sqrt_Float,  float,  15.0f,    3.0f,   sqrtf(n))
+BENCH(sqrt_Double, double, 15.0,     3.0,    sqrt(n))
+BENCH(sqrt_Q16,    int,    FIX(15),  FIX(3), sqrt64_Fixed((unsigned long long)n << FIX_BITS))
 
+BENCH(log2_Int,    int,    15,       3,      log2(n))
+BENCH(log2_Float,  float,  15.0f,    3.0f,   log2f(n))
+BENCH(log2_Double, double, 15.0,     3.0,    log2(n))
+BENCH(log2_Q16,    int,    15,       3,      log2_Fixed(n))
 
-VAR_TYPE TestFunction(VAR_TYPE n);
+BENCH(abs_Int,     int,    -15,      3,      abs(n))
+BENCH(abs_Float,   float,  -15.0f,   3.0f,   fabsf(n))
+BENCH(abs_Double,  double, -15.0,    3.0,    fabs(n))
+BENCH(abs_Q16,     int,    FIX(-15), FIX(3), n < 0 ? -n : n)
+
+#define BENCH_TYPES 4
+const char * const TYPE_NAMES[BENCH_TYPES] = {"int", "float", "double", "fixed"};
+const Bench OVERHEAD[BENCH_TYPES] = {none_Int, none_Float, none_Double, none_Q16};
+
+//One row per operation, 0 where a type has no version
+typedef struct{
+    const char * name;
+    Bench        cases[BENCH_TYPES];
+}BenchRow;
+
+const BenchRow BENCHES[] = {
+    {"add",  {add_Int,  add_Float,  add_Double,  add_Q16}},
+    {"mul",  {mul_Int,  mul_Float,  mul_Double,  mul_Q16}},
+    {"div",  {div_Int,  div_Float,  div_Double,  div_Q16}},
+    {"sin",  {sin_Int,  sin_Float,  sin_Double,  sin_Q15}},
+    {"sinh", {sinh_Int, sinh_Float, sinh_Double, 0}},
+    {"sqrt", {sqrt_Int, sqrt_Float, sqrt_Double, sqrt_Q16}},
+    {"log2", {log2_Int, log2_Float, log2_Double, log2_Q16}},
+    {"abs",  {abs_Int,  abs_Float,  abs_Double,  abs_Q16}}
+};
+
+unsigned int time_Bench(Bench bench);
+void print_Accuracy(void);
+void print_Blocking(const char * text);
 
 ///////////////////////////////////////////////////////////////////////
 //                        Main function                              //
 ///////////////////////////////////////////////////////////////////////
 
 int main(void) {
-    volatile VAR_TYPE y;                //Volatile ensures variable not optimized away
+    char line[64];
+    unsigned int overhead[BENCH_TYPES];
+    unsigned int row, type;
+
     WDTCTL = WDTPW | WDTHOLD;           // Stop watchdog timer
-    P1->SEL1 &= ~BIT0;                  //set P1.0 as simple I/O
-    P1->SEL0 &= ~BIT0;
-    P1->DIR |= BIT0;                    //set P1.0 as output
-    P2->SEL1 &= ~(BIT2 | BIT1 | BIT0);  //set P2.0-2.2 as simple I/O
-    P2->SEL0 &= ~(BIT2 | BIT1 | BIT0);
-    P2->DIR |= (BIT2 | BIT1 | BIT0);    //set P2.0-2.2 as output pins
-    P2->OUT |= (BIT2 | BIT1 | BIT0);    // turn on RGB LED
-    y = TestFunction(15);               // test function for timing
-    P2->OUT &= ~(BIT2 | BIT1 | BIT0);   // turn off RGB LED
+    set_DCO(FREQ_48_MHZ);               // Set to 48 MHz
+    init_UART(BAUD);                    // Start UART
+    __enable_irq();                     // Enable Global Interrupts
+    init_Cycles();                      // Start DWT cycle counter
+
+    for(type = 0; type < BENCH_TYPES; type++){
+        overhead[type] = time_Bench(OVERHEAD[type]);
+    }
+
+    sprintf(line, "\r\nCycles at %lu Hz, fewest of %u runs\r\n", (unsigned long)F_CPU, BENCH_RUNS);
+    print_Blocking(line);
+    sprintf(line, "%-6s", "op");
+    for(type = 0; type < BENCH_TYPES; type++){
+        sprintf(line + strlen(line), "%8s", TYPE_NAMES[type]);
+    }
+    print_Blocking(line);
+    print_Blocking("\r\n");
+
+    for(row = 0; row < sizeof(BENCHES)/sizeof(BENCHES[0]); row++){
+        sprintf(line, "%-6s", BENCHES[row].name);
+        for(type = 0; type < BENCH_TYPES; type++){
+            if(BENCHES[row].cases[type]){
+                unsigned int cycles = time_Bench(BENCHES[row].cases[type]);
+                sprintf(line + strlen(line), "%8u", cycles > overhead[type] ? cycles - overhead[type] : 0);
+            }else{
+                sprintf(line + strlen(line), "%8s", "-");
+            }
+        }
+        print_Blocking(line);
+        print_Blocking("\r\n");
+    }
+
+    sprintf(line, "%-6s", "ovhd");                  // Taken off every case above
+    for(type = 0; type < BENCH_TYPES; type++){
+        sprintf(line + strlen(line), "%8u", overhead[type]);
+    }
+    print_Blocking(line);
+    print_Blocking("\r\n");
+
+    print_Accuracy();
+    while(1);
 }
 
 ///////////////////////////////////////////////////////////////////////
-//                          Testing Function                         //
+//                          Testing Functions                        //
 ///////////////////////////////////////////////////////////////////////
-VAR_TYPE TestFunction(VAR_TYPE n) {
-    VAR_TYPE x = 0;
-    P1->OUT |= BIT0; // set P1.0 LED on
 
-    //Use fill in operation based on preprocessor defines
-    OPERATION
+/* time_Bench()
+ *  Runs a case BENCH_RUNS times with interrupts off
+ *
+ * Returns:
+ *  Fewest cycles of any run, overhead included
+ */
+unsigned int time_Bench(Bench bench){
+    unsigned int best = 0xFFFFFFFF;
+    unsigned int run, cycles;
+    for(run = 0; run < BENCH_RUNS; run++){
+        __disable_irq();                // UART ISR would land inside some runs
+        cycles = bench();
+        __enable_irq();
+        if(cycles < best){
+            best = cycles;
+        }
+    }
+    return best;
+}
+
+/* print_Blocking()
+ *  Waits for room in the TX ring so no part of the table is dropped
+ */
+void print_Blocking(const char * text){
+    while(*text){
+        while(!print_Char_UART(*text));
+        text++;
+    }
+}
+
+/* print_Accuracy()
+ *  Worst error of each Fixed_Math function over its input range, in
+ *  hundredths of an output LSB. Roots and divides should be exact.
+ */
+void print_Accuracy(void){
+    char line[64];
+    unsigned int i, misses;
+    double worst, error;
+
+    print_Blocking("\r\nFixed_Math worst error, 0.01 LSB\r\n");
+
+    worst = 0.0;
+    for(i = 0; i < FIXED_TURN; i++){
+        error = fabs(sin_Fixed(i) - 32768.0*sin(6.283185307179586*i/FIXED_TURN));
+        worst = (error > worst) ? error : worst;
+    }
+    sprintf(line, "%-6s%8u Q15\r\n", "sin", (unsigned int)(worst*100.0 + 0.5));
+    print_Blocking(line);
+
+    worst = 0.0;
+    for(i = 1; i < 0x00100000; i += 3){                // 20 octaves, table repeats every octave
+        error = fabs(log2_Fixed(i) - 65536.0*log2(i));
+        worst = (error > worst) ? error : worst;
+    }
+    sprintf(line, "%-6s%8u Q16\r\n", "log2", (unsigned int)(worst*100.0 + 0.5));
+    print_Blocking(line);
+
+    misses = 0;
+    for(i = 0; i < 0x00100000; i++){
+        unsigned int root = sqrt_Fixed(i);
+        if(root*root > i || (root + 1)*(root + 1) <= i){
+            misses++;
+        }
+    }
+    sprintf(line, "%-6s%8u wrong roots\r\n", "sqrt", misses);
+    print_Blocking(line);
 
-    P1->OUT &= ~BIT0; // set P1.0 LED off
-    return x;
+    misses = 0;
+    for(i = 1; i < 0x10000; i += 7){
+        unsigned int recip = recip_Fixed(i);
+        unsigned int value;
+        for(value = 0; value < 0x10000; value += 251){
+            if(divide_Fixed(value, recip) != value/i){
+                misses++;
+            }
+        }
+    }
+    sprintf(line, "%-6s%8u wrong quotients\r\n", "recip", misses);
+    print_Blocking(line);
 }
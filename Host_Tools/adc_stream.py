@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""
+adc_stream.py
+  Decodes binary ADC frames from ADC_Reading (MODE_ADC_BINARY, MODE_SPECTRUM,
+  MODE_SCOPE), see Stream.h
+
+  Usage:
+    adc_stream.py PORT [BAUD]     - Read from serial port (needs pyserial)
+    adc_stream.py FILE            - Read from a capture file
+
+  Prints one line per frame with sequence, timestamp and samples, or for
+  spectrum frames the peak bin, its frequency and the FFT time, or for
+  capture frames the trigger position and samples. Reports
+  sequence gaps (dropped frames) and CRC failures.
+"""
+import struct
+import sys
+
+STREAM_TYPE_ADC = 0x01
+STREAM_TYPE_SPECTRUM = 0x02
+STREAM_TYPE_CAPTURE = 0x03
+STREAM_FLAG_FALLING = 0x01
+F_CPU = 48000000
+STREAM_FLAG_TIMESTAMP = 0x01
+
+
+def crc16(data):
+    """CRC16 CCITT, poly 0x1021, init 0xFFFF."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def decode_cobs(data):
+    """Decodes one COBS block without its delimiter, None if malformed."""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def unpack_samples(data, count):
+    """Unpacks 14 bit samples stored LSB first."""
+    value = int.from_bytes(data, 'little')
+    return [(value >> (14 * i)) & 0x3FFF for i in range(count)]
+
+
+def parse_frame(frame):
+    """Returns (type, sequence, payload) or None if CRC fails."""
+    if len(frame) < 5:
+        return None
+    body, crc = frame[:-2], struct.unpack('<H', frame[-2:])[0]
+    if crc16(body) != crc:
+        return None
+    return body[0], struct.unpack('<H', body[1:3])[0], body[3:]
+
+
+def parse_samples(payload):
+    """Returns (timestamp or None, samples) from a STREAM_TYPE_ADC payload."""
+    flags = payload[0]
+    index = 1
+    timestamp = None
+    if flags & STREAM_FLAG_TIMESTAMP:
+        timestamp = struct.unpack('<I', payload[index:index + 4])[0]
+        index += 4
+    count = struct.unpack('<H', payload[index:index + 2])[0]
+    return timestamp, unpack_samples(payload[index + 2:], count)
+
+
+def parse_spectrum(payload):
+    """Returns (size, rate, cycles, bins) from a STREAM_TYPE_SPECTRUM payload."""
+    size, rate, cycles, count = struct.unpack('<HIIH', payload[:12])
+    return size, rate, cycles, list(struct.unpack('<%dH' % count, payload[12:12 + 2 * count]))
+
+
+def parse_capture(payload):
+    """Returns (falling, position, trigger, samples) from a STREAM_TYPE_CAPTURE payload."""
+    flags, position, trigger, count = struct.unpack('<BIHH', payload[:9])
+    return bool(flags & STREAM_FLAG_FALLING), position, trigger, unpack_samples(payload[9:], count)
+
+
+def frames(source):
+    """Yields decoded frames split on 0x00 delimiters."""
+    block = bytearray()
+    while True:
+        chunk = source.read(256)
+        if not chunk:
+            return
+        for byte in chunk:
+            if byte == 0:
+                if block:
+                    yield decode_cobs(bytes(block))
+                block = bytearray()
+            else:
+                block.append(byte)
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        return 1
+    try:
+        import serial
+        source = serial.Serial(sys.argv[1], int(sys.argv[2]) if len(sys.argv) > 2 else 750000)
+    except (ImportError, OSError, ValueError):
+        source = open(sys.argv[1], 'rb')
+
+    expected = None
+    dropped = bad = 0
+    for decoded in frames(source):
+        parsed = parse_frame(decoded) if decoded else None
+        if parsed is None:
+            bad += 1
+            print('# bad frame (%d total)' % bad)
+            continue
+        kind, sequence, payload = parsed
+        if expected is not None and sequence != expected:
+            dropped += (sequence - expected) & 0xFFFF
+            print('# gap: %d frame(s) dropped (%d total)' % ((sequence - expected) & 0xFFFF, dropped))
+        expected = (sequence + 1) & 0xFFFF
+        if kind == STREAM_TYPE_ADC:
+            timestamp, samples = parse_samples(payload)
+            print(sequence, timestamp, ' '.join(str(s) for s in samples))
+        elif kind == STREAM_TYPE_SPECTRUM:
+            size, rate, cycles, bins = parse_spectrum(payload)
+            peak = max(range(1, len(bins)), key=lambda n: bins[n]) if len(bins) > 1 else 0
+            print(sequence, 'peak bin %d %.1f Hz mag %d, fft %d cycles %.2f ms'
+                  % (peak, peak * rate / size, bins[peak], cycles, cycles * 1000.0 / F_CPU))
+        elif kind == STREAM_TYPE_CAPTURE:
+            falling, position, trigger, samples = parse_capture(payload)
+            print(sequence, 'trigger %s at sample %d (index %d)'
+                  % ('falling' if falling else 'rising', position, trigger),
+                  ' '.join(str(s) for s in samples))
+        else:
+            print(sequence, 'type 0x%02X' % kind, payload.hex())
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
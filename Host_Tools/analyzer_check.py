@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""
+analyzer_check.py
+  Runs a port of ADC_Reading/Analyzer.c on a simulated response
+
+  Usage:
+    analyzer_check.py [TABLES]   - Twiddle file, default ADC_Reading/FFT_Tables.c
+
+  For every frequency in FREQS and every gain and phase in CASES, ADC
+  sample k is a cosine at the stimulus phase of DAC sample k-1
+  (phase_Generator) plus the circuit phase, scaled by the gain, on a
+  mid-scale input with a little noise, rounded to whole counts. The sums
+  are bit exact with update_Analyzer, result_Analyzer is in double.
+  Prints each point and the worst gain and phase error over all of them.
+"""
+import math
+import os
+import random
+import re
+import sys
+
+FFT_BITS = 10                                   # Must match FFT.h
+FFT_SIZE = 1 << FFT_BITS
+GEN_SAMPLE_RATE = 20000                         # Must match Function_Generator.h
+GEN_TABLE_BITS = 8
+ANALYZER_SAMPLES = 4096                         # Must match Analyzer.h
+ANALYZER_SETTLE = 256
+ADC_BLOCK_SIZE = 256
+CAL_NOMINAL_GAIN = 13173                        # Calibration.h, mV per count Q16
+AMPLITUDE_MV = 1000                             # BODE_AMPLITUDE_MV, peak to peak
+NOISE = 2                                       # Counts either way
+FREQS = [1, 10, 20, 50, 97, 100, 200, 300, 500, 700, 1000, 1500, 2000]
+CASES = [(1.0, 0.0), (0.5, -30.0), (0.3, 45.0), (0.9, -120.0), (0.1, 170.0), (1.2, -90.0)]
+
+
+def load_twiddle(path):
+    with open(path) as source:
+        body = re.search(r'FFT_TWIDDLE\[[^]]*\]\s*=\s*\{([^}]*)\}', source.read()).group(1)
+    twiddle = [int(v) for v in body.replace('\n', ' ').split(',')]
+    if len(twiddle) != FFT_SIZE:
+        raise ValueError('%s does not match FFT_BITS' % path)
+    return twiddle
+
+
+def phase_generator(sample, step):
+    """Phase of DAC sample since sync, truncated to the table entry sent."""
+    return (sample * step) & 0xFFFFFFFF & ~((1 << (32 - GEN_TABLE_BITS)) - 1)
+
+
+def measure(twiddle, freq, gain, degrees, rng):
+    """One start_Analyzer, update_Analyzer and result_Analyzer point."""
+    step = (freq << 32) // GEN_SAMPLE_RATE
+    periods = (ANALYZER_SAMPLES * step + (1 << 32) - 1) >> 32
+    length = ((periods << 32) + step // 2) // step
+    first = max(((1 << 32) + step - 1) // step, ANALYZER_SETTLE)
+    counts = gain * AMPLITUDE_MV / 2 * 65536 / CAL_NOMINAL_GAIN
+    theta = math.radians(degrees)
+
+    sums = [0, 0, 0, 0, 0]                      # sumCos, sumSin, refCos, refSin, sumRaw
+    summed = 0
+    index = 0
+    while summed < length:                      # One ADC block at a time
+        for _ in range(ADC_BLOCK_SIZE):
+            if index >= first and summed < length:
+                phase = phase_generator(index - 1, step)
+                x = int(round(8192 + counts * math.cos(2 * math.pi * phase / 2 ** 32 + theta) +
+                              rng.uniform(-NOISE, NOISE)))
+                angle = phase >> (32 - FFT_BITS)
+                if angle < FFT_SIZE // 2:
+                    c, s = twiddle[2 * angle], twiddle[2 * angle + 1]
+                else:
+                    c, s = -twiddle[2 * (angle - FFT_SIZE // 2)], -twiddle[2 * (angle - FFT_SIZE // 2) + 1]
+                for slot, value in enumerate((x * c, x * s, c, s, x)):
+                    sums[slot] += value
+                summed += 1
+            index += 1
+
+    mean = sums[4] / summed
+    i = (sums[0] - mean * sums[2]) / 32768
+    q = (sums[1] - mean * sums[3]) / 32768
+    mV = 2 * math.hypot(i, q) / summed * CAL_NOMINAL_GAIN / 65536
+    return summed, mV, 20 * math.log10(2 * mV / AMPLITUDE_MV), math.degrees(math.atan2(-q, i))
+
+
+def main():
+    default = os.path.join(os.path.dirname(__file__), '..', 'ADC_Reading', 'FFT_Tables.c')
+    twiddle = load_twiddle(sys.argv[1] if len(sys.argv) > 1 else default)
+    rng = random.Random(1)
+    worst_db = worst_degrees = 0.0
+    for freq in FREQS:
+        for gain, degrees in CASES:
+            summed, mV, db, phase = measure(twiddle, freq, gain, degrees, rng)
+            error_db = db - 20 * math.log10(gain)
+            error_degrees = (phase - degrees + 180) % 360 - 180
+            worst_db = max(worst_db, abs(error_db))
+            worst_degrees = max(worst_degrees, abs(error_degrees))
+            print('f=%u n=%u amp=%.0f mV gain=%+.2f dB (%+.3f) phase=%+.2f deg (%+.3f)' %
+                  (freq, summed, mV, db, error_db, phase, error_degrees))
+    print('worst %.3f dB, %.3f degrees' % (worst_db, worst_degrees))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
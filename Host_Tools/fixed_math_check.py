@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""
+fixed_math_check.py
+  Sweeps a bit exact port of ADC_Reading/Fixed_Math.c against math
+
+  Usage:
+    fixed_math_check.py [TABLES]   - Tables file, default ADC_Reading/Fixed_Tables.c
+
+  Reads the shipped tables, then prints worst error of sin and cos over
+  every phase in Q15 LSB, worst error of log2 in Q16 LSB over every 16 bit
+  value and random 32 bit ones, mismatch counts for the integer roots, and
+  for the reciprocal divide over every 16 bit value and divisor.
+  Returns 1 if any root or 16 bit divide is off.
+"""
+import math
+import os
+import random
+import re
+import sys
+
+SIN_BITS = 8                                    # Must match Fixed_Math.h
+LOG2_BITS = 6
+QUARTER_BITS = 14
+SIN_FRACTION = QUARTER_BITS - SIN_BITS
+TURN = 0x10000
+MASK32 = 0xFFFFFFFF
+
+
+def load_tables(path):
+    """Returns (FIXED_SIN, FIXED_LOG2) as lists from a Fixed_Tables.c."""
+    with open(path) as source:
+        text = source.read()
+
+    def values(name):
+        body = re.search(r'\b%s\[[^]]*\]\s*=\s*\{([^}]*)\}' % name, text).group(1)
+        return [int(v) for v in body.replace('\n', ' ').split(',')]
+    sine, log2 = values('FIXED_SIN'), values('FIXED_LOG2')
+    if len(sine) != (1 << SIN_BITS) + 1 or len(log2) != (1 << LOG2_BITS) + 1:
+        raise ValueError('%s does not match SIN_BITS and LOG2_BITS' % path)
+    return sine, log2
+
+
+def sin_fixed(sine, phase):
+    quadrant = (phase >> QUARTER_BITS) & 3
+    offset = phase & ((1 << QUARTER_BITS) - 1)
+    if quadrant & 1:
+        offset = (1 << QUARTER_BITS) - offset
+    index = offset >> SIN_FRACTION
+    fraction = offset & ((1 << SIN_FRACTION) - 1)
+    value = sine[index]
+    if fraction:
+        value += ((sine[index + 1] - value) * fraction + (1 << (SIN_FRACTION - 1))) >> SIN_FRACTION
+    return -value if quadrant & 2 else value
+
+
+def cos_fixed(sine, phase):
+    return sin_fixed(sine, (phase + TURN // 4) & MASK32)
+
+
+def sqrt_fixed(value, top=30):
+    root = 0
+    bit = 1 << top
+    while bit > value:
+        bit >>= 2
+    while bit:
+        if value >= root + bit:
+            value -= root + bit
+            root = (root >> 1) + bit
+        else:
+            root >>= 1
+        bit >>= 2
+    return root
+
+
+def sqrt64_fixed(value):
+    if value <= MASK32:
+        return sqrt_fixed(value)
+    return sqrt_fixed(value, 62) & MASK32
+
+
+def log2_fixed(table, value):
+    exponent = 31
+    for step in (16, 8, 4, 2, 1):
+        if not value & (MASK32 << (32 - step)) & MASK32:
+            value = (value << step) & MASK32
+            exponent -= step
+    index = (value >> (31 - LOG2_BITS)) & ((1 << LOG2_BITS) - 1)
+    fraction = (value >> (15 - LOG2_BITS)) & 0xFFFF
+    step = ((table[index + 1] - table[index]) * fraction) & MASK32
+    return (exponent << 16) + table[index] + (((step + 0x8000) & MASK32) >> 16)
+
+
+def recip_fixed(divisor):
+    return MASK32 // divisor
+
+
+def divide_fixed(value, recip):
+    return ((value * recip + value) >> 32) & MASK32
+
+
+def main():
+    default = os.path.join(os.path.dirname(__file__), '..', 'ADC_Reading', 'Fixed_Tables.c')
+    sine, log2 = load_tables(sys.argv[1] if len(sys.argv) > 1 else default)
+    rng = random.Random(1)
+
+    worst_sin = worst_cos = 0
+    for phase in range(TURN):
+        angle = 2 * math.pi * phase / TURN
+        worst_sin = max(worst_sin, abs(sin_fixed(sine, phase) - 32768 * math.sin(angle)))
+        worst_cos = max(worst_cos, abs(cos_fixed(sine, phase) - 32768 * math.cos(angle)))
+    print('sin worst %.2f Q15 LSB, cos worst %.2f Q15 LSB over %d phases' % (worst_sin, worst_cos, TURN))
+
+    values = list(range(1, 1 << 16)) + [rng.randrange(1 << 16, 1 << 32) for _ in range(200000)]
+    worst_log2 = max(abs(log2_fixed(log2, v) - 65536 * math.log2(v)) for v in values)
+    print('log2 worst %.2f Q16 LSB over %d values' % (worst_log2, len(values)))
+
+    roots = list(range(1 << 16)) + [rng.randrange(1 << 32) for _ in range(200000)] + \
+            [n * n + d for n in (0xFFFF, 0x10000 - 2) for d in (-1, 0, 1)] + [MASK32]
+    bad_sqrt = sum(sqrt_fixed(v) != math.isqrt(v) for v in roots)
+    roots64 = [rng.randrange(1 << 64) for _ in range(200000)] + \
+              [n * n + d for n in (MASK32, 0x10000) for d in (-1, 0, 1)] + [(1 << 64) - 1]
+    bad_sqrt64 = sum(sqrt64_fixed(v) != math.isqrt(v) for v in roots64)
+    print('sqrt %d of %d wrong, sqrt64 %d of %d wrong' % (bad_sqrt, len(roots), bad_sqrt64, len(roots64)))
+
+    #Quotient only steps at multiples of the divisor and divide_fixed never
+    #falls as value rises, so checking each side of every step covers all
+    #16 bit values and divisors
+    bad_divide = 0
+    for divisor in range(1, 1 << 16):
+        recip = recip_fixed(divisor)
+        for step in range(divisor, 1 << 16, divisor):
+            bad_divide += divide_fixed(step - 1, recip) != step // divisor - 1
+            bad_divide += divide_fixed(step, recip) != step // divisor
+        bad_divide += divide_fixed(0xFFFF, recip) != 0xFFFF // divisor
+    print('16 bit divide %d pairs wrong' % bad_divide)
+    return 1 if bad_sqrt or bad_sqrt64 or bad_divide else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+"""
+gen_fft_tables.py
+  Writes ADC_Reading/FFT_Tables.c, the Q15 twiddle and window tables for FFT.c
+
+  Usage:
+    gen_fft_tables.py [BITS]     - FFT size 2^BITS, default 10 (1024 points)
+
+  BITS must match FFT_BITS in FFT.h. Rerun after changing it.
+"""
+import math
+import os
+import sys
+
+
+def q15(value):
+    return max(-32768, min(32767, int(round(value * 32768))))
+
+
+def table(name, values, per_line=8):
+    lines = ['const short %s[ %d ] = {' % (name, len(values))]
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        lines.append('    ' + ', '.join('%6d' % v for v in chunk) + ',')
+    lines[-1] = lines[-1].rstrip(',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main():
+    bits = int(sys.argv[1]) if len(sys.argv) > 1 else 10
+    size = 1 << bits
+    twiddle = []
+    for k in range(size // 2):                  # W^k = cos - j sin, stored as cos, sin
+        angle = 2 * math.pi * k / size
+        twiddle += [q15(math.cos(angle)), q15(math.sin(angle))]
+    window = [q15(0.5 - 0.5 * math.cos(2 * math.pi * i / size)) for i in range(size // 2 + 1)]
+
+    path = os.path.join(os.path.dirname(__file__), '..', 'ADC_Reading', 'FFT_Tables.c')
+    with open(path, 'w') as out:
+        out.write('''/*
+ *  FFT_Tables.c
+ *    Q15 tables for FFT.c, generated by Host_Tools/gen_fft_tables.py %d
+ *    Do not edit, rerun the script instead
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "FFT.h"
+
+//Twiddle factors W^k = cos - j*sin for k = 0 to FFT_SIZE/2-1, pairs of cos, sin
+%s
+
+//Periodic Hann window, first half, w[FFT_SIZE-i] = w[i]
+%s
+''' % (bits, table('FFT_TWIDDLE', twiddle), table('FFT_WINDOW', window)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""
+gen_fixed_tables.py
+  Writes ADC_Reading/Fixed_Tables.c, the sine and log2 tables for Fixed_Math.c
+
+  Usage:
+    gen_fixed_tables.py [PATH]   - Output file, default ADC_Reading/Fixed_Tables.c
+
+  Sizes must match FIXED_SIN_BITS and FIXED_LOG2_BITS in Fixed_Math.h.
+  Assignment_6 keeps a copy, pass its path to regenerate it too.
+"""
+import math
+import os
+import sys
+
+SIN_BITS = 8                                    # Entries per quarter turn, 2^SIN_BITS
+LOG2_BITS = 6                                   # Entries per octave, 2^LOG2_BITS
+
+
+def table(kind, name, values, per_line=8):
+    lines = ['const %s %s[ %d ] = {' % (kind, name, len(values))]
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        lines.append('    ' + ', '.join('%6d' % v for v in chunk) + ',')
+    lines[-1] = lines[-1].rstrip(',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main():
+    default = os.path.join(os.path.dirname(__file__), '..', 'ADC_Reading', 'Fixed_Tables.c')
+    path = sys.argv[1] if len(sys.argv) > 1 else default
+    quarter = 1 << SIN_BITS
+    octave = 1 << LOG2_BITS
+    sine = [min(32767, int(round(32768 * math.sin(math.pi / 2 * i / quarter)))) for i in range(quarter + 1)]
+    log2 = [int(round(65536 * math.log2(1 + i / octave))) for i in range(octave + 1)]
+
+    with open(path, 'w') as out:
+        out.write('''/*
+ *  Fixed_Tables.c
+ *    Tables for Fixed_Math.c, generated by Host_Tools/gen_fixed_tables.py
+ *    Do not edit, rerun the script instead
+ *
+ *  Author: Drew Hartley, Jordan Jones
+ */
+#include "Fixed_Math.h"
+
+//Q15 sine of the first quarter turn, entry i is sin(pi/2*i/FIXED_SIN_LENGTH)
+%s
+
+//Q16 log2(1 + i/FIXED_LOG2_LENGTH), one octave
+%s
+''' % (table('short', 'FIXED_SIN', sine), table('unsigned int', 'FIXED_LOG2', log2)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""
+goertzel_check.py
+  Runs a bit exact port of ADC_Reading/Goertzel.c on synthetic ADC blocks
+
+  Usage:
+    goertzel_check.py [RATE]   - Samples per second, default 10000 (SAMPLE_RATE)
+
+  Each block is a 1000 Hz tone of 1000 counts and a 4990 Hz tone of 400
+  counts peak on a mid-scale 14 bit input, rounded to whole counts. The
+  bank holds those two tones and the neighbours in TONES. For each block
+  length the highest level over PHASES start phases is printed per tone,
+  in raw counts, then the worst error of the two real tones in percent.
+  4990 Hz sits next to its own image at 5010 Hz, so short blocks show how
+  far a tone near rate/2 can be off.
+"""
+import math
+import struct
+import sys
+
+GOERTZEL_SHIFT = 29                             # Must match Goertzel.h
+GOERTZEL_LEVEL_BITS = 4
+SIGNAL = {1000: 1000.0, 4990: 400.0}            # Hz: peak counts
+TONES = [10, 50, 1000, 1040, 3000, 4990]
+LENGTHS = [256, 512, 1024]                      # ADC_BLOCK_SIZE and longer
+PHASES = 16
+
+
+def f32(value):
+    """Rounds to single precision like the float math on the target."""
+    return struct.unpack('<f', struct.pack('<f', value))[0]
+
+
+def coefficient(freq, rate):
+    """2cos(2*pi*f/rate) in Q29 as set_Goertzel builds it with cosf."""
+    pi = f32(3.14159265)
+    angle = f32(f32(f32(2 * pi) * freq) / rate)
+    value = f32(f32(2.0 * f32(math.cos(angle))) * (1 << GOERTZEL_SHIFT))
+    return int(math.floor(abs(value) + 0.5)) * (1 if value >= 0 else -1)   # lroundf
+
+
+def wrap32(value):
+    """Keeps a value in signed 32 bit range like an int on the target."""
+    return ((value + 0x80000000) & 0xFFFFFFFF) - 0x80000000
+
+
+def sqrt64(value):
+    return math.isqrt(value) & 0xFFFFFFFF       # sqrt64_Fixed is exact, see fixed_math_check.py
+
+
+def goertzel(samples, coefs):
+    """run_Goertzel then result_Goertzel over one block, levels in Q4."""
+    mean = sum(samples) // len(samples)
+    levels = []
+    for coef in coefs:
+        s1 = s2 = 0
+        for sample in samples:
+            s0 = wrap32((sample - mean) + ((coef * s1) >> GOERTZEL_SHIFT) - s2)
+            s2, s1 = s1, s0
+        power = s1 * s1 + s2 * s2 - (((coef * s1) >> GOERTZEL_SHIFT) * s2)
+        levels.append(sqrt64(max(power, 0) << (2 * (GOERTZEL_LEVEL_BITS + 1))) // len(samples))
+    return levels
+
+
+def block(length, rate, phase):
+    """Mid-scale 14 bit block of SIGNAL tones, phase in turns."""
+    return [int(round(8192 + sum(amplitude * math.sin(2 * math.pi * (freq * n / rate + phase))
+                                 for freq, amplitude in SIGNAL.items())))
+            for n in range(length)]
+
+
+def main():
+    rate = int(sys.argv[1]) if len(sys.argv) > 1 else 10000
+    coefs = [coefficient(freq, rate) for freq in TONES]
+    print('rate %d Hz, signal %s' % (rate, ', '.join('%d Hz %.0f' % t for t in SIGNAL.items())))
+    print('%6s  %s' % ('N', '  '.join('%9d' % f for f in TONES)))
+    for length in LENGTHS:
+        worst = [0.0] * len(TONES)
+        error = {freq: 0.0 for freq in SIGNAL}
+        for step in range(PHASES):
+            levels = goertzel(block(length, rate, step / PHASES), coefs)
+            for tone, freq in enumerate(TONES):
+                level = levels[tone] / (1 << GOERTZEL_LEVEL_BITS)
+                worst[tone] = max(worst[tone], level)
+                if freq in SIGNAL:
+                    error[freq] = max(error[freq], abs(level - SIGNAL[freq]) * 100 / SIGNAL[freq])
+        print('%6d  %s  | %s' % (length, '  '.join('%9.1f' % w for w in worst),
+                                 ', '.join('%d Hz %.2f%%' % e for e in error.items())))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""
+log_decode.py
+  Formats deferred binary log records from ADC_Reading, see Log.h
+
+  Usage:
+    log_decode.py IMAGE.out PORT [BAUD]   - Read from serial port (needs pyserial)
+    log_decode.py IMAGE.out FILE          - Read from a capture file
+
+  IMAGE.out must be the exact build running on the board, its .logstr
+  section holds the format strings that record IDs point at. Bytes that
+  are not part of a record are passed through as text.
+"""
+import struct
+import sys
+
+LOG_SYNC = 0xA5
+LOG_MAX_ARGS = 4
+
+
+def load_strings(path):
+    """Returns (address, data) of the .logstr section of an ELF32 image."""
+    with open(path, 'rb') as image:
+        elf = image.read()
+    if elf[:4] != b'\x7fELF' or elf[4] != 1:
+        raise ValueError('%s is not an ELF32 image' % path)
+    endian = '<' if elf[5] == 1 else '>'
+    shoff, = struct.unpack(endian + 'I', elf[32:36])
+    shentsize, shnum, shstrndx = struct.unpack(endian + 'HHH', elf[46:52])
+
+    def header(index):
+        return struct.unpack(endian + 'IIIIIIIIII',
+                             elf[shoff + index * shentsize:shoff + (index + 1) * shentsize])
+
+    names = header(shstrndx)
+    for index in range(shnum):
+        name, _, _, addr, offset, size = header(index)[:6]
+        start = names[4] + name
+        if elf[start:elf.index(b'\0', start)] == b'.logstr':
+            return addr, elf[offset:offset + size]
+    raise ValueError('%s has no .logstr section' % path)
+
+
+def c_string(section, address, offset):
+    """Reads the format string a record ID points at, None if out of range."""
+    index = offset - address
+    if index < 0 or index >= len(section):
+        return None
+    end = section.find(b'\0', index)
+    return section[index:end].decode('ascii', 'replace')
+
+
+def format_record(text, words):
+    """Applies a printf style format to raw 32 bit argument words."""
+    out = ''
+    args = iter(words)
+    i = 0
+    while i < len(text):
+        if text[i] != '%':
+            out += text[i]
+            i += 1
+            continue
+        j = i + 1
+        while j < len(text) and text[j] not in 'diuxXcfeEgGp%':
+            j += 1
+        spec = text[i:j + 1]
+        kind = text[j] if j < len(text) else '%'
+        if kind == '%':
+            out += '%'
+        else:
+            word = next(args, 0)
+            if kind in 'di':
+                value = struct.unpack('<i', struct.pack('<I', word))[0]
+            elif kind in 'feEgG':
+                value = struct.unpack('<f', struct.pack('<I', word))[0]
+            elif kind == 'p':
+                spec, value = '0x%08x', word
+            else:
+                value = word
+            out += spec.replace('l', '').replace('h', '') % value
+        i = j + 1
+    return out
+
+
+def decode(stream, address, section, write):
+    """Splits a byte stream into text and records, calls write with output."""
+    pending = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            break
+        pending += chunk
+        while pending:
+            if pending[0] != LOG_SYNC:
+                end = pending.find(bytes([LOG_SYNC]))
+                end = len(pending) if end < 0 else end
+                write(pending[:end].decode('ascii', 'replace'))
+                del pending[:end]
+                continue
+            if len(pending) < 6:
+                break
+            count = pending[1]
+            size = 6 + 4 * count
+            text = None
+            if count <= LOG_MAX_ARGS:
+                text = c_string(section, address, struct.unpack('<I', pending[2:6])[0])
+            if text is None:                       # Not a record, resync on next byte
+                write('?')
+                del pending[:1]
+                continue
+            if len(pending) < size:
+                break
+            words = struct.unpack('<%dI' % count, pending[6:size])
+            write(format_record(text, words) + '\n')
+            del pending[:size]
+
+
+def main():
+    if len(sys.argv) < 3:
+        print(__doc__)
+        return 1
+    address, section = load_strings(sys.argv[1])
+    try:
+        import serial
+        source = serial.Serial(sys.argv[2], int(sys.argv[3]) if len(sys.argv) > 3 else 750000)
+    except (ImportError, OSError, ValueError):
+        source = open(sys.argv[2], 'rb')
+
+    def write(text):
+        sys.stdout.write(text)
+        sys.stdout.flush()
+    decode(source, address, section, write)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
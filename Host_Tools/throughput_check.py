@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""
+throughput_check.py
+  Checks the MODE_THROUGHPUT pattern from ADC_Reading, see run_Throughput
+
+  Usage:
+    throughput_check.py PORT [BAUD]   - Read from serial port (needs pyserial)
+    throughput_check.py FILE          - Read from a capture file
+
+  Every pattern line must be "SSSSSSSS:" then the fixed payload, with S
+  one more than the line before. Each '#' report from the board is printed
+  with the gaps and bad lines seen since the last report. Board skips show
+  up as gaps, so gaps beyond the skipped count were lost on the link or
+  the host. Totals are printed at the end or on Ctrl-C.
+"""
+import re
+import sys
+
+PATTERN_LENGTH = 64                            # Bytes per line including CR LF
+PAYLOAD = ''.join(chr(ord('A') + i % 26) for i in range(9, PATTERN_LENGTH - 2))
+REPORT = re.compile(r'# (\d+) B/s of (\d+), skipped (\d+) lines')
+
+
+def parse_line(text):
+    """Returns the sequence number of a pattern line, None if malformed."""
+    if len(text) != PATTERN_LENGTH - 2 or text[8] != ':' or text[9:] != PAYLOAD:
+        return None
+    try:
+        return int(text[:8], 16)
+    except ValueError:
+        return None
+
+
+class Checker:
+    """Follows sequence numbers and counts lines, gaps and bad lines."""
+
+    def __init__(self):
+        self.expected = None
+        self.lines = self.gaps = self.bad = self.skipped = 0
+        self.second_gaps = self.second_bad = 0
+
+    def pattern(self, text):
+        sequence = parse_line(text)
+        if sequence is None:
+            self.bad += 1
+            self.second_bad += 1
+            return
+        if self.expected is not None and sequence != self.expected:
+            gap = (sequence - self.expected) & 0xFFFFFFFF
+            self.gaps += gap
+            self.second_gaps += gap
+        self.expected = (sequence + 1) & 0xFFFFFFFF
+        self.lines += 1
+
+    def report(self, text):
+        match = REPORT.match(text)
+        if match is None:
+            self.bad += 1
+            return None
+        skipped = int(match.group(3))
+        self.skipped += skipped
+        line = '%s | host gaps=%u bad=%u' % (text, self.second_gaps, self.second_bad)
+        self.second_gaps = self.second_bad = 0
+        return line
+
+    def summary(self):
+        return 'lines=%u gaps=%u board_skipped=%u lost=%d bad=%u' % (
+            self.lines, self.gaps, self.skipped, self.gaps - self.skipped, self.bad)
+
+
+def check(source, write):
+    """Checks every line from source, calls write with report lines."""
+    checker = Checker()
+    try:
+        for raw in source:
+            text = raw.decode('ascii', 'replace').rstrip('\r\n')
+            if not text:
+                continue
+            if text.startswith('#'):
+                line = checker.report(text)
+                if line:
+                    write(line)
+            else:
+                checker.pattern(text)
+    except KeyboardInterrupt:
+        pass
+    write(checker.summary())
+    return checker
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        return 1
+    try:
+        import serial
+        source = serial.Serial(sys.argv[1], int(sys.argv[2]) if len(sys.argv) > 2 else 750000)
+    except (ImportError, OSError, ValueError):
+        source = open(sys.argv[1], 'rb')
+
+    def write(text):
+        sys.stdout.write(text + '\n')
+        sys.stdout.flush()
+    checker = check(source, write)
+    return 1 if checker.bad or checker.gaps != checker.skipped else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -12,12 +12,14 @@
  *   Waveform.h     - Holds datatypes and functions for waveform configuration
  *   Liquid_Crystal - Holds functions for LCD
  *   Keypad         - Holds functions for using keypad
+ *   Trace.h        - Marks ISRs on P2 for a logic analyzer when TRACE_MODE is set
  *
  * Errors:
  *   None Currently May 3, 2017
  *
  * Revisions:
  *   May 3,  2017 - Initial Creation
+ *   Oct 19, 2026 - Trace marks on timer and keypad ISRs
  *
  *  Author: Drew Hartley, Jordan Jones
  *
@@ -36,6 +38,7 @@
 #include "SPI.h"
 #include "DAC.h"
 #include "Waveforms.h"
+#include "Trace.h"
 
 ///////////////////////////////////////////////////////////////////////
 //                        NOT TO BE EDITTED DEFINES                  //
@@ -104,6 +107,7 @@ ISRConfig ISRData = {{15000,15000},{MAX_VAL_DAC,MIN_VAL_DAC}};
 void main(void){
     WDTCTL = WDTPW | WDTHOLD;       // Stop watchdog timer
     set_DCO(FREQ_48_MHZ);           // Setup MCLK at 48 MHz
+    init_Trace();                   // Nothing unless TRACE_MODE is set
 
     //Setup SPI, LCD, Keypad, DAC
     init_SPI();
@@ -285,6 +289,7 @@ void configure_Timer_Sin(void){
  */
 void TA0_0_IRQHandler(void){
 static unsigned int index = 0;                      //Index for arrays
+    TRACE_ENTER(TRACE_TA0);
     //Send most recent value to DAC
     send_DAC(ISRData.value[index]);
     //Offset compare value of timer
@@ -295,6 +300,7 @@ static unsigned int index = 0;                      //Index for arrays
 
     //Clear flag on exit
     TIMER_A0->CCTL[0] &= ~TIMER_A_CCTLN_CCIFG;
+    TRACE_EXIT(TRACE_TA0);
 }
 
 ///////////////////////////////////////////////////////////////////////
@@ -312,6 +318,7 @@ static unsigned int index = 0;                      //Index for arrays
  */
 void TA1_0_IRQHandler(void){
     static unsigned int currentValue = MIN_VAL_DAC; // Value for DAC
+    TRACE_ENTER(TRACE_TA1);
 
     //Send most recent value to DAC
     send_DAC(currentValue);
@@ -328,6 +335,7 @@ void TA1_0_IRQHandler(void){
 
     //Clear flag on exit
     TIMER_A1->CCTL[0] &= ~TIMER_A_CCTLN_CCIFG;
+    TRACE_EXIT(TRACE_TA1);
 }
 
 ///////////////////////////////////////////////////////////////////////
@@ -348,6 +356,7 @@ void TA2_0_IRQHandler(void){
     static int incrementIndex = 1;          // Value for incrementing index
     static int countState = 0;              // Value for deciding if count up or down
     static int index = 0;                   // Current Index
+    TRACE_ENTER(TRACE_TA2);
     //Upload most recent value to DAC
     send_DAC(currentValue);
     //Calculate next value for next ISR
@@ -367,6 +376,7 @@ void TA2_0_IRQHandler(void){
     TIMER_A2->CCR[0] += ISRData.delay[0];
     // Clear Flag
     TIMER_A2->CCTL[0] &= ~TIMER_A_CCTLN_CCIFG;
+    TRACE_EXIT(TRACE_TA2);
 }
 
 
@@ -385,6 +395,7 @@ void TA2_0_IRQHandler(void){
  */
  
 void PORT4_IRQHandler(void){
+    TRACE_ENTER(TRACE_PORT4);
     //Stop all interrupts
     TIMER_A0->CCTL[0] &= ~TIMER_A_CCTLN_CCIE;
     TIMER_A1->CCTL[0] &= ~TIMER_A_CCTLN_CCIE;
@@ -396,4 +407,5 @@ void PORT4_IRQHandler(void){
 
     //Clear flag before exit
     COLUMN_PORT->IFG &= ~COLUMN_PINS;
+    TRACE_EXIT(TRACE_PORT4);
 }
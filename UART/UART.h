@@ -3,19 +3,37 @@
  *
  *   This libary holds functions for UART, specifically for assignment 7
  *    init_UART         - Starts UART at a give baud
+ *    calculate_Baud_UART - Finds divider and modulation registers for a baud
+ *    get_Baud_UART     - Returns baud actually generated
+ *    get_Baud_Error_UART - Returns worst case bit timing error in 0.01% units
  *    print_Char_UART   - Prints a single char to the terminal
  *    print_String_UART - Prints a string to the terminal
  *    int_getDACValue   - Returns value of DAC
  *    int hasNewValue   - Returns whether there is a new value for DAC
+ *    overflow_UART     - Returns number of bytes dropped because TX buffer was full
+ *    available_UART    - Returns number of received bytes waiting
+ *    read_Char_UART    - Returns next received byte
+ *    flush_RX_UART     - Drops all received bytes
+ *    init_Line_UART    - Attaches caller storage to a line reader
+ *    read_Line_UART    - Builds an echoed line from received bytes, non-blocking
+ *    get_Token_UART    - Splits a line into space separated tokens
+ *    rx_Dropped_UART   - Returns number of bytes dropped because RX buffer was full
+ *    rx_Overrun_UART   - Returns number of bytes lost before the ISR read them
+ *
+ *   RX ISR only stores bytes, all parsing happens in the calling thread
  *
  * Depenedencies:
  *   MSP.h -  Needed for direct register access
+ *   Ring_Buffer.h - Holds TX/RX data between the ISR and the calling thread
  *
  * Errors:
  *   None Currently May 5, 2017
  *
  * Revisions:
  *   May 5,  2017 - Initial Creation
+ *   Oct 19, 2026 - TX moved onto power-of-two ring buffer with overflow count
+ *   Oct 19, 2026 - RX ring, ISR only stores bytes, line reader in thread context
+ *   Oct 19, 2026 - Float divider and BRS if-chain replaced by integer search
  *
  *  Author: Drew Hartley, Jordan Jones
  *
@@ -25,19 +43,49 @@
 #define UART_UART_H_
 #include "MSP.h"
 #include <string.h>
-#define UART_BUFFER_LENGTH 20
+#include "Ring_Buffer.h"
+#define UART_BUFFER_LENGTH 32           // Must be a power of two
+#define UART_LINE_LENGTH   32           // Longest line kept by hasNewValue
 #define F_CPU 48000000
 
+//Divider terms, constant expressions when clock and baud are constants
+#define UART_FRAME_BITS         10      // Start, 8 data, stop
+#define UART_OS16(clock, baud)  ((clock)/(baud) >= 16)
+#define UART_BRW(clock, baud)   (UART_OS16(clock, baud) ? (clock)/(16*(baud)) : (clock)/(baud))
+#define UART_BRF(clock, baud)   (UART_OS16(clock, baud) ? ((clock)%(16*(baud)))/(baud) : 0)
+
+//Data struct for a baud calculation
+typedef struct{
+    unsigned int  brw;                  // Value for BRW
+    unsigned int  mctlw;                // Value for MCTLW (OS16, BRF, BRS)
+    unsigned long baud;                 // Baud actually generated
+    int           error;                // Worst case bit error, 0.01% units
+}BaudConfig;
+
+//Line being built by read_Line_UART, one per caller so lines never mix
+typedef struct{
+    char *       text;                  // Caller storage, kept for the whole line
+    unsigned int length;                // Size of text including terminator
+    unsigned int index;                 // Characters stored so far
+}LineBuffer;
+
 
 void init_UART(unsigned int baud);
-void print_Char_UART(char data);
-void print_String_UART(const char* data);
+void calculate_Baud_UART(unsigned long clock, unsigned long baud, BaudConfig * config);
+unsigned long get_Baud_UART(void);
+int  get_Baud_Error_UART(void);
+int  print_Char_UART(char data);
+int  print_String_UART(const char* data);
+unsigned int overflow_UART(void);
 int  getDACValue(void);
 int  hasNewValue(void);
-
-//Commented out useful for later implementations
-//int  available_UART(void);
-//char read_Char_UART(void);
-//void flush_RX_UART(void);
+int  available_UART(void);
+char read_Char_UART(void);
+void flush_RX_UART(void);
+int  init_Line_UART(LineBuffer * line, char * text, unsigned int length);
+int  read_Line_UART(LineBuffer * line);
+char * get_Token_UART(char ** cursor);
+unsigned int rx_Dropped_UART(void);
+unsigned int rx_Overrun_UART(void);
 
 #endif /* UART_UART_H_ */
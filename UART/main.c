@@ -2,8 +2,8 @@
  * Assignment 7 UART
  *
  *   This assignment takes in a value 0-4095 over UART and outputs it to the
- *   MCP4921 when enter is pressed in the terminal. It also error checks the
- *   input automatically within the ISR.
+ *   MCP4921 when enter is pressed in the terminal. The ISR only buffers input,
+ *   the line is echoed and error checked in hasNewValue from the main loop.
  *
  * Depenedencies:
  *   Clocks.h       - Holds functions for delays and cpu frequency changes
@@ -16,6 +16,7 @@
  *
  * Revisions:
  *   May 5,  2017 - Initial Creation
+ *   Oct 19, 2026 - Input checking moved out of the UART ISR
  *
  *  Author: Drew Hartley, Jordan Jones
  *